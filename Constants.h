@@ -3,5 +3,7 @@
 #include "types.hpp"
 
 struct Constants {
-    static const Price InvalidPrice = std::numeric_limits<Price>::quiet_NaN();
+    static constexpr Price InvalidPrice = std::numeric_limits<Price>::quiet_NaN();
+    static constexpr Price TickSize = 1; // Prices are whole cents
+    static constexpr OwnerId NoOwner = 0; // Orders without an owner never count as self trades
 };
\ No newline at end of file
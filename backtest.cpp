@@ -0,0 +1,193 @@
+#include "backtest_runner.hpp"
+#include "order_flow.hpp"
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * Replays recorded order flow files (order_flow.hpp), one per symbol and day, across a work stealing thread
+ * pool (backtest_runner.hpp). Prints every file as it finishes with its throughput, then the totals, with the
+ * hardware counters per request summed over all the workers unless --no-perf is given.
+ * --generate writes synthetic files to try it on: symbols times days files of random adds, cancels and
+ * modifies around a drifting price.
+ *
+ * usage: order_book_backtest [--threads N] [--no-perf] FILE...
+ *        order_book_backtest --generate DIR [--symbols N] [--days D] [--requests R] [--seed S]
+ */
+
+namespace {
+    struct GenerateOptions {
+        std::string directory_;
+        std::size_t symbols_ {8};
+        std::size_t days_ {5};
+        std::uint64_t requests_ {1'000'000};
+        std::uint64_t seed_ {42};
+    };
+
+    // YYYYMMDD of the day after 2026-01-01
+    std::uint32_t DateAfter(std::size_t days)
+    {
+        std::tm date{};
+        date.tm_year = 126;
+        date.tm_mday = 1 + static_cast<int>(days);
+        date.tm_hour = 12;
+        std::mktime(&date);
+        return static_cast<std::uint32_t>((date.tm_year + 1900) * 10000 + (date.tm_mon + 1) * 100 + date.tm_mday);
+    }
+
+    // Random flow around a price that drifts: mostly passive adds, cancels and modifies of live orders, and now
+    // and then an order that crosses
+    void GenerateDay(const std::string& path, const std::string& symbol, std::uint32_t date, std::uint64_t requests, std::mt19937_64& random)
+    {
+        OrderFlowWriter writer{path, symbol, date};
+        std::uniform_int_distribution<int> action(0, 99);
+        std::uniform_int_distribution<Price> offset(1, 20);
+        std::uniform_int_distribution<Quantity> quantity(1, 100);
+        std::uniform_int_distribution<int> drift(-1, 1);
+
+        Price mid = 10'000;
+        OrderId nextId = 1;
+        std::vector<OrderId> live;
+        for (std::uint64_t sequence = 1; sequence <= requests; ++sequence) {
+            const auto roll = action(random);
+            if (roll < 25 && !live.empty()) {
+                const auto index = std::uniform_int_distribution<std::size_t>(0, live.size() - 1)(random);
+                std::swap(live[index], live.back());
+                writer.Append(MakeCancelRequest(sequence, live.back()));
+                live.pop_back();
+                continue;
+            }
+            if (roll < 35 && !live.empty()) {
+                // A new price and quantity, which the book applies as a cancel and replace
+                const auto id = live[std::uniform_int_distribution<std::size_t>(0, live.size() - 1)(random)];
+                const auto side = id % 2 ? Side::Sell : Side::Buy;
+                writer.Append(MakeModifyRequest(sequence, id, side, side == Side::Buy ? mid - offset(random) : mid + offset(random), quantity(random)));
+                continue;
+            }
+
+            mid = std::max<Price>(100, mid + drift(random));
+            OrderEntry entry;
+            entry.orderId_ = nextId++;
+            entry.side_ = entry.orderId_ % 2 ? Side::Sell : Side::Buy;
+            entry.quantity_ = quantity(random);
+            const bool crosses = roll >= 95;
+            entry.type_ = crosses ? OrderType::FillAndKill : OrderType::GoodTillCancel;
+            // Passive orders rest on their own side of the price, crossing ones reach past it
+            const auto away = offset(random);
+            entry.price_ = (entry.side_ == Side::Buy) != crosses ? mid - away : mid + away;
+            writer.Append(MakeAddRequest(sequence, entry));
+            if (!crosses)
+                live.push_back(entry.orderId_);
+        }
+        writer.Close();
+    }
+
+    int Generate(const GenerateOptions& options)
+    {
+        std::filesystem::create_directories(options.directory_);
+        std::mt19937_64 random{options.seed_};
+        for (std::size_t symbol = 0; symbol < options.symbols_; ++symbol) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "SYM%03zu", symbol);
+            for (std::size_t day = 0; day < options.days_; ++day) {
+                const auto date = DateAfter(day);
+                const auto path = (std::filesystem::path{options.directory_} / (std::string{name} + "-" + std::to_string(date) + ".flow")).string();
+                GenerateDay(path, name, date, options.requests_, random);
+            }
+        }
+        std::printf("wrote %zu files of %llu requests to %s\n", options.symbols_ * options.days_,
+            static_cast<unsigned long long>(options.requests_), options.directory_.c_str());
+        return 0;
+    }
+
+    int Replay(const std::vector<std::string>& paths, std::size_t threads, bool perf)
+    {
+        const BacktestRunner runner{threads};
+        std::printf("replaying %zu files on %zu threads\n", paths.size(), runner.Threads());
+
+        // Run starts and joins its workers, so counters that follow new threads count them all
+        std::unique_ptr<PerfCounters> counters;
+        if (perf) {
+            counters = std::make_unique<PerfCounters>(true);
+            if (!counters->Available()) {
+                std::printf("perf counters unavailable (%s)\n", counters->Error().c_str());
+                counters.reset();
+            }
+        }
+
+        if (counters)
+            counters->Start();
+        const auto summary = runner.Run(paths, [](const BacktestResult& result) {
+            if (!result.error_.empty()) {
+                std::printf("  %s failed: %s\n", result.path_.c_str(), result.error_.c_str());
+                return;
+            }
+            std::printf("  %-8s %u requests=%-9llu trades=%-8llu rejected=%-6llu resting=%-7zu %.3fs rate=%.0f/s worker=%zu%s\n",
+                result.symbol_.c_str(), result.date_, static_cast<unsigned long long>(result.requests_),
+                static_cast<unsigned long long>(result.trades_), static_cast<unsigned long long>(result.rejected_),
+                result.restingOrders_, result.seconds_, result.Rate(), result.worker_, result.stolen_ ? " stolen" : "");
+        });
+        const auto values = counters ? counters->Stop() : PerfCounterValues{};
+
+        std::printf("done files=%zu failed=%zu stolen=%zu elapsed=%.2fs task time=%.2fs speedup=%.2fx\n",
+            summary.results_.size(), summary.failed_, summary.stolen_, summary.seconds_, summary.taskSeconds_,
+            summary.seconds_ > 0 ? summary.taskSeconds_ / summary.seconds_ : 0.0);
+        std::printf("  requests=%llu rate=%.0f/s trades=%llu filled=%llu rejected=%llu\n",
+            static_cast<unsigned long long>(summary.requests_), summary.Rate(), static_cast<unsigned long long>(summary.trades_),
+            static_cast<unsigned long long>(summary.filledQuantity_), static_cast<unsigned long long>(summary.rejected_));
+        if (counters)
+            std::printf("  %s\n", FormatPerfCounters(values, summary.requests_).c_str());
+        return summary.failed_ == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    GenerateOptions generate;
+    std::size_t threads = 0;
+    bool perf = true;
+    std::vector<std::string> paths;
+    bool valid = true;
+    for (int i = 1; i < argc && valid; ++i) {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = std::stoul(argv[++i]);
+        else if (std::strcmp(argv[i], "--no-perf") == 0)
+            perf = false;
+        else if (std::strcmp(argv[i], "--generate") == 0 && i + 1 < argc)
+            generate.directory_ = argv[++i];
+        else if (std::strcmp(argv[i], "--symbols") == 0 && i + 1 < argc)
+            generate.symbols_ = std::stoul(argv[++i]);
+        else if (std::strcmp(argv[i], "--days") == 0 && i + 1 < argc)
+            generate.days_ = std::stoul(argv[++i]);
+        else if (std::strcmp(argv[i], "--requests") == 0 && i + 1 < argc)
+            generate.requests_ = std::stoull(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            generate.seed_ = std::stoull(argv[++i]);
+        else if (argv[i][0] != '-')
+            paths.push_back(argv[i]);
+        else
+            valid = false;
+    }
+
+    if (!valid || (generate.directory_.empty() == paths.empty())) {
+        std::cerr << "usage: " << argv[0] << " [--threads N] [--no-perf] FILE...\n"
+                  << "       " << argv[0] << " --generate DIR [--symbols N] [--days D] [--requests R] [--seed S]" << std::endl;
+        return 1;
+    }
+
+    try {
+        return generate.directory_.empty() ? Replay(paths, threads, perf) : Generate(generate);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,146 @@
+#include "backtest_runner.hpp"
+#include "order_book.hpp"
+#include "order_flow.hpp"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // One worker's tasks, indexes into the paths
+    struct WorkerQueue {
+        std::mutex mutex_;
+        std::deque<std::size_t> tasks_;
+    };
+
+    // The next task of worker: its own oldest, or else the newest of the first other worker that has any
+    std::optional<std::size_t> TakeTask(std::vector<WorkerQueue>& queues, std::size_t worker, bool& stolen)
+    {
+        {
+            auto& own = queues[worker];
+            std::scoped_lock lock{own.mutex_};
+            if (!own.tasks_.empty()) {
+                const auto task = own.tasks_.front();
+                own.tasks_.pop_front();
+                stolen = false;
+                return task;
+            }
+        }
+
+        // Tasks never add tasks, so once every deque was seen empty there is nothing left to wait for
+        for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+            auto& victim = queues[(worker + offset) % queues.size()];
+            std::scoped_lock lock{victim.mutex_};
+            if (!victim.tasks_.empty()) {
+                const auto task = victim.tasks_.back();
+                victim.tasks_.pop_back();
+                stolen = true;
+                return task;
+            }
+        }
+        return std::nullopt;
+    }
+}
+
+BacktestResult ReplayOrderFlow(const std::string& path)
+{
+    BacktestResult result;
+    result.path_ = path;
+    try {
+        const OrderFlowFile file{path};
+        result.symbol_ = file.Symbol();
+        result.date_ = file.Header().date_;
+
+        OrderBook book;
+        GatewayResponse response;
+        const auto* records = file.Records();
+        const auto count = file.Count();
+
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            ServeGatewayRequest(book, records[i], response);
+            if (response.status_ == static_cast<std::uint8_t>(GatewayStatus::Rejected))
+                ++result.rejected_;
+            result.trades_ += response.trades_;
+            result.filledQuantity_ += response.filledQuantity_;
+        }
+        result.seconds_ = std::chrono::duration<double>(Clock::now() - start).count();
+        result.requests_ = count;
+        result.restingOrders_ = book.Size();
+    }
+    catch (const std::exception& e) {
+        result.error_ = e.what();
+    }
+    return result;
+}
+
+BacktestRunner::BacktestRunner(std::size_t threads)
+: threads_{threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency())}
+{}
+
+BacktestSummary BacktestRunner::Run(const std::vector<std::string>& paths, const Progress& progress) const
+{
+    BacktestSummary summary;
+    summary.results_.resize(paths.size());
+
+    // Largest first, so the long days start early and the short ones fill the gaps at the end
+    std::vector<std::uintmax_t> sizes(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        std::error_code error;
+        sizes[i] = std::filesystem::file_size(paths[i], error);
+        if (error)
+            sizes[i] = 0;
+    }
+    std::vector<std::size_t> order(paths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t left, std::size_t right) { return sizes[left] > sizes[right]; });
+
+    const auto workers = std::min(threads_, std::max<std::size_t>(paths.size(), 1));
+    std::vector<WorkerQueue> queues(workers);
+    for (std::size_t i = 0; i < order.size(); ++i)
+        queues[i % workers].tasks_.push_back(order[i]);
+
+    std::mutex progressMutex;
+    auto Work = [&](std::size_t worker) {
+        bool stolen = false;
+        while (const auto task = TakeTask(queues, worker, stolen)) {
+            auto result = ReplayOrderFlow(paths[*task]);
+            result.worker_ = worker;
+            result.stolen_ = stolen;
+            // Each task writes only its own slot
+            summary.results_[*task] = std::move(result);
+            if (progress) {
+                std::scoped_lock lock{progressMutex};
+                progress(summary.results_[*task]);
+            }
+        }
+    };
+
+    const auto start = Clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (std::size_t worker = 1; worker < workers; ++worker)
+        threads.emplace_back(Work, worker);
+    Work(0);
+    for (auto& thread : threads)
+        thread.join();
+    summary.seconds_ = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (const auto& result : summary.results_) {
+        summary.requests_ += result.requests_;
+        summary.rejected_ += result.rejected_;
+        summary.trades_ += result.trades_;
+        summary.filledQuantity_ += result.filledQuantity_;
+        summary.taskSeconds_ += result.seconds_;
+        summary.failed_ += result.error_.empty() ? 0 : 1;
+        summary.stolen_ += result.stolen_ ? 1 : 0;
+    }
+    return summary;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * Replays recorded order flow files (order_flow.hpp) in parallel. Every file is one task with its own
+ * OrderBook, so tasks share nothing but the queues they are taken from. Each worker thread has its own deque,
+ * the tasks are dealt out largest file first; a worker takes from the front of its own deque and, once that is
+ * empty, steals from the back of another one, so a few long days do not leave the other threads idle.
+ */
+
+// What one file did to its book
+struct BacktestResult {
+    std::string path_;
+    std::string symbol_;
+    std::uint32_t date_ {};
+    std::uint64_t requests_ {};
+    std::uint64_t rejected_ {};
+    std::uint64_t trades_ {};
+    std::uint64_t filledQuantity_ {};   // Traded by the orders of the requests
+    std::size_t restingOrders_ {};      // Left in the book after the last request
+    double seconds_ {};                 // Replay time, without mapping the file
+    std::size_t worker_ {};             // Thread that replayed it
+    bool stolen_ {};                    // Taken from another thread's deque
+    std::string error_;                 // Why the file could not be replayed, empty if it was
+
+    double Rate() const { return seconds_ > 0 ? requests_ / seconds_ : 0.0; }
+};
+
+struct BacktestSummary {
+    std::vector<BacktestResult> results_;   // In the order of the paths
+    std::uint64_t requests_ {};
+    std::uint64_t rejected_ {};
+    std::uint64_t trades_ {};
+    std::uint64_t filledQuantity_ {};
+    std::size_t failed_ {};
+    std::size_t stolen_ {};
+    double seconds_ {};                     // Wall time of the whole run
+    double taskSeconds_ {};                 // Replay time summed over the tasks
+
+    double Rate() const { return seconds_ > 0 ? requests_ / seconds_ : 0.0; }
+};
+
+// Replay one file into a new book on the calling thread. Errors end up in BacktestResult::error_
+BacktestResult ReplayOrderFlow(const std::string& path);
+
+class BacktestRunner
+{
+    public:
+        // Called with every finished task, from the worker threads but never two at a time
+        using Progress = std::function<void(const BacktestResult&)>;
+
+        // threads 0 is one per hardware thread
+        explicit BacktestRunner(std::size_t threads = 0);
+
+        BacktestSummary Run(const std::vector<std::string>& paths, const Progress& progress = {}) const;
+        std::size_t Threads() const { return threads_; }
+
+    private:
+        std::size_t threads_;
+};
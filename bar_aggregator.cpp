@@ -0,0 +1,84 @@
+#include "bar_aggregator.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+BarAggregator::BarAggregator(const std::vector<std::chrono::nanoseconds>& intervals, std::size_t history)
+: intervals_{intervals}
+{
+    if (intervals.empty())
+        throw std::invalid_argument("Bar aggregator needs at least one interval");
+    if (history == 0)
+        throw std::invalid_argument("Bar aggregator needs to keep at least one bar");
+
+    series_.reserve(intervals.size());
+    for (const auto interval : intervals) {
+        if (interval.count() <= 0)
+            throw std::invalid_argument("Bar interval of " + std::to_string(interval.count()) + "ns is not positive");
+        series_.push_back(Series{static_cast<std::uint64_t>(interval.count()), std::nullopt, std::vector<Bar>(history)});
+    }
+}
+
+void BarAggregator::OnTrade(std::uint64_t timestamp, std::int64_t price, std::uint64_t quantity)
+{
+    for (auto& series : series_) {
+        const auto start = timestamp - timestamp % series.interval_;
+        if (series.open_ && start > series.open_->start_)
+            Finalize(series);
+
+        if (!series.open_) {
+            series.open_ = Bar{start, price, price, price, price, quantity, static_cast<double>(price) * quantity, 1};
+            continue;
+        }
+
+        auto& bar = *series.open_;
+        bar.high_ = std::max(bar.high_, price);
+        bar.low_ = std::min(bar.low_, price);
+        bar.close_ = price;
+        bar.volume_ += quantity;
+        bar.notional_ += static_cast<double>(price) * quantity;
+        ++bar.trades_;
+    }
+}
+
+void BarAggregator::Advance(std::uint64_t timestamp)
+{
+    for (auto& series : series_)
+        if (series.open_ && timestamp >= series.open_->start_ + series.interval_)
+            Finalize(series);
+}
+
+std::vector<BarAggregator::Bar> BarAggregator::GetBars(std::chrono::nanoseconds interval, std::size_t count) const
+{
+    const auto& series = Find(interval);
+    count = std::min(count, series.finalized_);
+
+    std::vector<Bar> bars;
+    bars.reserve(count);
+    const auto size = series.history_.size();
+    for (std::size_t i = count; i > 0; --i)
+        bars.push_back(series.history_[(series.next_ + size - i) % size]);
+    return bars;
+}
+
+std::optional<BarAggregator::Bar> BarAggregator::GetOpenBar(std::chrono::nanoseconds interval) const
+{
+    return Find(interval).open_;
+}
+
+const BarAggregator::Series& BarAggregator::Find(std::chrono::nanoseconds interval) const
+{
+    auto series = std::find_if(series_.begin(), series_.end(),
+        [interval](const Series& series) { return series.interval_ == static_cast<std::uint64_t>(interval.count()); });
+    if (series == series_.end())
+        throw std::invalid_argument("No bars are built at an interval of " + std::to_string(interval.count()) + "ns");
+    return *series;
+}
+
+void BarAggregator::Finalize(Series& series)
+{
+    series.history_[series.next_] = *series.open_;
+    series.next_ = (series.next_ + 1) % series.history_.size();
+    series.finalized_ = std::min(series.finalized_ + 1, series.history_.size());
+    series.open_.reset();
+}
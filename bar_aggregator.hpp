@@ -0,0 +1,63 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/*
+ * OHLCV bars of one book at several intervals, built trade by trade: each trade updates the open bar of every
+ * interval in constant time and nothing is ever rescanned. Bars are aligned to multiples of their interval since
+ * the epoch. A bar is finalized by the first trade past its end, or by Advance once the clock is, and then kept
+ * in a ring of the last history bars. Intervals without trades have no bar.
+ * The book feeds it on the matching thread (OrderBook::SetBarAggregator), it is not thread safe.
+ */
+class BarAggregator
+{
+    public:
+        struct Bar {
+            std::uint64_t start_;   // Nanoseconds since the epoch at the start of the interval
+            std::int64_t open_;
+            std::int64_t high_;
+            std::int64_t low_;
+            std::int64_t close_;
+            std::uint64_t volume_;
+            double notional_;       // Sum of price times quantity, for the VWAP
+            std::uint64_t trades_;
+
+            double Vwap() const { return volume_ ? notional_ / volume_ : 0.0; }
+        };
+
+        static constexpr std::size_t DefaultHistory = 1024;
+
+        // std::invalid_argument if there are no intervals, one is not positive, or history is 0
+        explicit BarAggregator(const std::vector<std::chrono::nanoseconds>& intervals, std::size_t history = DefaultHistory);
+
+        // timestamp in nanoseconds since the epoch. A trade older than the open bar counts towards it
+        void OnTrade(std::uint64_t timestamp, std::int64_t price, std::uint64_t quantity);
+        // Finalize the open bars that end at or before timestamp
+        void Advance(std::uint64_t timestamp);
+
+        // The last count finalized bars of interval, oldest first, fewer if not that many are kept.
+        // std::invalid_argument for an interval the aggregator does not build
+        std::vector<Bar> GetBars(std::chrono::nanoseconds interval, std::size_t count) const;
+        // The bar of interval still taking trades, if any
+        std::optional<Bar> GetOpenBar(std::chrono::nanoseconds interval) const;
+        const std::vector<std::chrono::nanoseconds>& GetIntervals() const { return intervals_; }
+
+    private:
+        // The bars of one interval, finalized ones in a ring overwriting the oldest
+        struct Series {
+            std::uint64_t interval_;
+            std::optional<Bar> open_;
+            std::vector<Bar> history_;
+            std::size_t next_ {0};      // Slot of the next finalized bar
+            std::size_t finalized_ {0}; // Bars kept, at most history_.size()
+        };
+
+        std::vector<std::chrono::nanoseconds> intervals_;
+        std::vector<Series> series_;
+
+        const Series& Find(std::chrono::nanoseconds interval) const;
+        static void Finalize(Series& series);
+};
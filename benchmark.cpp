@@ -0,0 +1,386 @@
+#include "order_book.hpp"
+#include "itch_encoder.hpp"
+#include "matching_loop.hpp"
+#include "shm_gateway.hpp"
+#include "thread_affinity.hpp"
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+
+/*
+ * Micro benchmarks of the order book hot paths.
+ * Every scenario reports per-operation latency and, when the kernel allows it, hardware counters
+ * (cycles, instructions, IPC, cache misses, branch misses) read around the same region.
+ * MixedFlow runs twice, the second time encoding market data (itch_encoder.hpp) for every book event.
+ * The last scenarios replay one flow through books built with different traits (see order_book_traits.hpp)
+ * to compare widths, level stores, order indexes and huge page backed memory (mapped with --arena-mb,
+ * 256MB by default).
+ * The wakeup scenarios hand tasks to a MatchingLoop after an idle gap and time until the loop thread runs
+ * them, once parking at once and once busy polling (on --matching-cpu when given).
+ * The gateway scenario round trips add and cancel requests through the shared memory gateway to a busy polling
+ * matching thread, which is what a co-located client sees.
+ *
+ * usage: order_book_benchmark [--orders N] [--no-perf] [--matching-cpu CPU] [--arena-mb MB]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::size_t orders_ {200000};
+        bool perf_ {true};
+        std::optional<int> matchingCpu_;
+        std::size_t arenaMegabytes_ {256};
+    };
+
+    struct Result {
+        std::string name_;
+        std::vector<std::uint64_t> latencies_;
+        PerfCounterValues counters_;
+    };
+
+    constexpr Price MidPrice = 10000;
+
+    // Orders that rest without crossing: bids below the mid, asks above it
+    template <typename Book = OrderBook>
+    std::vector<typename Book::OrderPointer> MakeRestingOrders(std::size_t count, OrderId firstId, std::mt19937_64& random)
+    {
+        std::uniform_int_distribution<Price> offset(1, 200);
+        std::uniform_int_distribution<Quantity> quantity(1, 100);
+        std::vector<typename Book::OrderPointer> orders;
+        orders.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto side = i % 2 ? Side::Sell : Side::Buy;
+            const auto price = side == Side::Buy ? MidPrice - offset(random) : MidPrice + offset(random);
+            orders.push_back(Book::MakeOrder(OrderType::GoodTillCancel, firstId + i, side, price, quantity(random)));
+        }
+        return orders;
+    }
+
+    // Times each call of step(i) for i in [0, count) and reads the counters around the whole loop
+    Result Measure(const std::string& name, std::size_t count, PerfCounters* counters, const std::function<void(std::size_t)>& step)
+    {
+        Result result { name, {}, {} };
+        result.latencies_.reserve(count);
+
+        if (counters)
+            counters->Start();
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto start = Clock::now();
+            step(i);
+            const auto end = Clock::now();
+            result.latencies_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+
+        if (counters)
+            result.counters_ = counters->Stop();
+        return result;
+    }
+
+    void Report(Result& result)
+    {
+        auto& latencies = result.latencies_;
+        if (latencies.empty())
+            return;
+
+        std::sort(latencies.begin(), latencies.end());
+        const auto total = std::accumulate(latencies.begin(), latencies.end(), std::uint64_t{0});
+        auto percentile = [&](double p) { return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]; };
+
+        std::printf("%-24s ops=%-8zu mean=%7.1fns p50=%6lluns p99=%7lluns max=%8lluns\n",
+            result.name_.c_str(), latencies.size(), static_cast<double>(total) / latencies.size(),
+            static_cast<unsigned long long>(percentile(0.50)),
+            static_cast<unsigned long long>(percentile(0.99)),
+            static_cast<unsigned long long>(latencies.back()));
+        std::printf("%-24s %s\n", "", FormatPerfCounters(result.counters_, latencies.size()).c_str());
+    }
+
+    // Time from handing a task to the loop until its thread runs it, after the loop sat idle for a while
+    Result MeasureWakeup(const std::string& name, const MatchingLoopOptions& options, std::size_t count)
+    {
+        MatchingLoop loop{options};
+        Result result { name, {}, {} };
+        result.latencies_.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            const auto start = Clock::now();
+            loop.Run([&] {
+                result.latencies_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+            });
+        }
+        return result;
+    }
+
+    // Alternating adds and cancels of one resting order, each timed from send until its response is read.
+    // Client and matching thread busy poll, and yield instead when there is only one CPU for both
+    Result MeasureGateway(const std::string& name, std::optional<int> matchingCpu, std::size_t count)
+    {
+        const bool spin = std::thread::hardware_concurrency() > 1;
+        const MatchingLoopOptions options{matchingCpu, spin ? 10'000'000u : 0u, 10'000'000};
+        const auto segment = "orderbook-benchmark-" + std::to_string(getpid());
+        OrderBook orderBook;
+        ShmGateway gateway{segment, 1, [&](const GatewayRequest& request, GatewayResponse& response) {
+            ServeGatewayRequest(orderBook, request, response);
+        }};
+        MatchingLoop loop{options};
+        loop.SetPoller([&] { return gateway.Poll(); });
+        ShmGatewayClient client{ShmGateway::SegmentName(segment, 0)};
+
+        Result result { name, {}, {} };
+        result.latencies_.reserve(count);
+        OrderEntry entry;
+        entry.side_ = Side::Buy;
+        entry.price_ = MidPrice;
+        entry.quantity_ = 10;
+        GatewayResponse response;
+        for (std::size_t i = 0; i < count; ++i) {
+            entry.orderId_ = i / 2 + 1;
+            const auto request = i % 2 ? MakeCancelRequest(i, entry.orderId_) : MakeAddRequest(i, entry);
+            const auto start = Clock::now();
+            client.TrySend(request);
+            while (!client.TryReceive(response)) {
+                if (spin)
+                    CpuRelax();
+                else
+                    std::this_thread::yield();
+            }
+            result.latencies_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        }
+        return result;
+    }
+
+    // Resting adds, aggressive FillAndKill orders and cancels of what is left, on a book built with other traits.
+    // Every configuration gets the same seed and so the same flow
+    template <typename Book>
+    void CompareConfiguration(const std::string& label, std::size_t count, PerfCounters* counters, std::vector<Result>& results)
+    {
+        std::mt19937_64 random { 7 };
+        Book orderBook;
+
+        auto orders = MakeRestingOrders<Book>(count, 1, random);
+        results.push_back(Measure("AddResting/" + label, orders.size(), counters,
+            [&](std::size_t i) { orderBook.AddOrder(orders[i]); }));
+
+        std::uniform_int_distribution<Quantity> quantity(1, 50);
+        std::vector<typename Book::OrderPointer> aggressors;
+        for (std::size_t i = 0; i < count / 4; ++i) {
+            const auto side = i % 2 ? Side::Sell : Side::Buy;
+            const auto price = side == Side::Buy ? MidPrice + 200 : MidPrice - 200;
+            aggressors.push_back(Book::MakeOrder(OrderType::FillAndKill, count + 1 + i, side, price, quantity(random)));
+        }
+        results.push_back(Measure("AggressiveFAK/" + label, aggressors.size(), counters,
+            [&](std::size_t i) { orderBook.AddOrder(aggressors[i]); }));
+
+        std::vector<OrderId> cancelIds;
+        for (const auto& order : orders)
+            cancelIds.push_back(order->GetOrderId());
+        std::shuffle(cancelIds.begin(), cancelIds.end(), random);
+        results.push_back(Measure("CancelResting/" + label, cancelIds.size(), counters,
+            [&](std::size_t i) { orderBook.CancelOrder(cancelIds[i]); }));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--orders") == 0 && i + 1 < argc)
+            options.orders_ = std::stoull(argv[++i]);
+        else if (std::strcmp(argv[i], "--no-perf") == 0)
+            options.perf_ = false;
+        else if (std::strcmp(argv[i], "--matching-cpu") == 0 && i + 1 < argc)
+            options.matchingCpu_ = std::stoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--arena-mb") == 0 && i + 1 < argc)
+            options.arenaMegabytes_ = std::stoull(argv[++i]);
+        else {
+            std::cerr << "usage: " << argv[0] << " [--orders N] [--no-perf] [--matching-cpu CPU] [--arena-mb MB]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<PerfCounters> counters;
+    if (options.perf_) {
+        counters = std::make_unique<PerfCounters>();
+        if (!counters->Available()) {
+            std::cout << "perf counters unavailable (" << counters->Error() << "), reporting latency only" << std::endl;
+            counters.reset();
+        }
+        else if (!counters->Error().empty()) {
+            std::cout << "some perf counters unavailable (" << counters->Error() << ")" << std::endl;
+        }
+    }
+
+    std::mt19937_64 random { 42 };
+    std::vector<Result> results;
+
+    // Resting adds followed by cancels in random order
+    {
+        OrderBook orderBook;
+        auto orders = MakeRestingOrders(options.orders_, 1, random);
+        results.push_back(Measure("AddResting", orders.size(), counters.get(),
+            [&](std::size_t i) { orderBook.AddOrder(orders[i]); }));
+
+        std::vector<OrderId> cancelIds;
+        cancelIds.reserve(orders.size());
+        for (const auto& order : orders)
+            cancelIds.push_back(order->GetOrderId());
+        std::shuffle(cancelIds.begin(), cancelIds.end(), random);
+
+        results.push_back(Measure("CancelResting", cancelIds.size(), counters.get(),
+            [&](std::size_t i) { orderBook.CancelOrder(cancelIds[i]); }));
+    }
+
+    // Mass cancels by owner: the same resting book spread over 100 owners, one call per owner
+    {
+        OrderBook orderBook;
+        constexpr OwnerId Owners = 100;
+        for (const auto& order : MakeRestingOrders(options.orders_, 1, random)) {
+            order->SetOwner(static_cast<OwnerId>(1 + order->GetOrderId() % Owners));
+            orderBook.AddOrder(order);
+        }
+
+        results.push_back(Measure("MassCancelOwner", Owners, counters.get(), [&](std::size_t i) {
+            MassCancelFilter filter;
+            filter.owner_ = static_cast<OwnerId>(i + 1);
+            orderBook.MassCancel(filter);
+        }));
+    }
+
+    // Aggregated levels against the full L3 snapshot of the same deep book, one call per sample
+    {
+        OrderBook orderBook;
+        for (const auto& order : MakeRestingOrders(options.orders_, 1, random))
+            orderBook.AddOrder(order);
+
+        constexpr std::size_t Snapshots = 100;
+        results.push_back(Measure("LevelInfos", Snapshots, counters.get(),
+            [&](std::size_t) { orderBook.GetOrderInfos(); }));
+
+        std::vector<OrderSnapshot> snapshot(orderBook.Size());
+        results.push_back(Measure("OrderSnapshot", Snapshots, counters.get(),
+            [&](std::size_t) { orderBook.GetOrderSnapshot(snapshot.data(), snapshot.size()); }));
+    }
+
+    // Call auctions: many small books filled during the auction, then uncrossed one after the other
+    {
+        constexpr std::size_t Books = 100;
+        const auto ordersPerBook = std::max<std::size_t>(options.orders_ / Books, 2);
+        std::uniform_int_distribution<Price> price(MidPrice - 50, MidPrice + 50);
+        std::uniform_int_distribution<Quantity> quantity(1, 100);
+
+        std::vector<std::unique_ptr<OrderBook>> books;
+        for (std::size_t book = 0; book < Books; ++book) {
+            books.push_back(std::make_unique<OrderBook>());
+            books.back()->BeginAuction();
+            for (std::size_t i = 0; i < ordersPerBook; ++i)
+                books.back()->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, i + 1,
+                    i % 2 ? Side::Sell : Side::Buy, price(random), quantity(random)));
+        }
+
+        results.push_back(Measure("AuctionUncross", books.size(), counters.get(),
+            [&](std::size_t i) { books[i]->Uncross(); }));
+    }
+
+    // Aggressive FillAndKill orders that each take the top of a deep book
+    {
+        OrderBook orderBook;
+        for (const auto& order : MakeRestingOrders(options.orders_, 1, random))
+            orderBook.AddOrder(order);
+
+        std::uniform_int_distribution<Quantity> quantity(1, 50);
+        std::vector<OrderPointer> aggressors;
+        const auto count = options.orders_ / 4;
+        aggressors.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto side = i % 2 ? Side::Sell : Side::Buy;
+            const auto price = side == Side::Buy ? MidPrice + 200 : MidPrice - 200;
+            aggressors.push_back(std::make_shared<Order>(OrderType::FillAndKill, options.orders_ + 1 + i, side, price, quantity(random)));
+        }
+
+        results.push_back(Measure("AggressiveFAK", aggressors.size(), counters.get(),
+            [&](std::size_t i) { orderBook.AddOrder(aggressors[i]); }));
+    }
+
+    // Mixed flow: mostly resting adds, some cancels of live orders, some aggressive orders. It runs a second
+    // time with the book publishing market data, for what encoding costs per operation
+    const auto flowRandom = random;
+    auto MixedFlow = [&](const std::string& name, ItchEncoder* marketData) {
+        auto random = flowRandom;
+        OrderBook orderBook;
+        orderBook.SetMarketDataEncoder(marketData);
+        auto resting = MakeRestingOrders(options.orders_, 1, random);
+        std::uniform_int_distribution<int> action(0, 99);
+        std::uniform_int_distribution<Quantity> quantity(1, 50);
+
+        struct Step { int kind_; OrderPointer order_; OrderId cancelId_; };
+        std::vector<Step> steps;
+        steps.reserve(options.orders_);
+        std::size_t added = 0;
+        OrderId nextAggressorId = 2 * options.orders_ + 1;
+
+        for (std::size_t i = 0; i < options.orders_ && added < resting.size(); ++i) {
+            const auto roll = action(random);
+            if (roll < 60 || added == 0) {
+                steps.push_back({0, resting[added++], 0});
+            }
+            else if (roll < 90) {
+                std::uniform_int_distribution<std::size_t> pick(0, added - 1);
+                steps.push_back({1, nullptr, resting[pick(random)]->GetOrderId()});
+            }
+            else {
+                const auto side = roll % 2 ? Side::Sell : Side::Buy;
+                const auto price = side == Side::Buy ? MidPrice + 50 : MidPrice - 50;
+                steps.push_back({0, std::make_shared<Order>(OrderType::FillAndKill, nextAggressorId++, side, price, quantity(random)), 0});
+            }
+        }
+
+        results.push_back(Measure(name, steps.size(), counters.get(), [&](std::size_t i) {
+            if (steps[i].kind_ == 0)
+                orderBook.AddOrder(steps[i].order_);
+            else
+                orderBook.CancelOrder(steps[i].cancelId_);
+        }));
+    };
+    MixedFlow("MixedFlow", nullptr);
+    {
+        // Messages are encoded and dropped, only the encoding is measured
+        ItchEncoder encoder{1, "BENCH", 1 << 16, [](std::uint64_t, std::size_t, const std::uint8_t*, std::size_t) {}};
+        MixedFlow("MixedFlow/marketdata", &encoder);
+    }
+
+    // The same flow through each shipped book configuration
+    CompareConfiguration<OrderBook>("default", options.orders_, counters.get(), results);
+    CompareConfiguration<WideOrderBook>("wide64", options.orders_, counters.get(), results);
+    CompareConfiguration<LadderOrderBook>("ladder", options.orders_, counters.get(), results);
+    CompareConfiguration<TreeIndexOrderBook>("treeindex", options.orders_, counters.get(), results);
+    const auto& arena = HugePageArena::ConfigureDefault(options.arenaMegabytes_ << 20);
+    std::cout << "hugepage arena: " << (arena.Capacity() >> 20) << "MB on " << ToString(arena.GetBacking()) << std::endl;
+    CompareConfiguration<HugePageOrderBook>("hugepage", options.orders_, counters.get(), results);
+
+    // Wakeup of the matching thread: blocking versus pinned busy polling. The spin budget outlasts the idle gap
+    {
+        constexpr std::size_t Wakeups = 2000;
+        results.push_back(MeasureWakeup("Wakeup/park", MatchingLoopOptions{}, Wakeups));
+        results.push_back(MeasureWakeup("Wakeup/spin", MatchingLoopOptions{options.matchingCpu_, 10'000'000, 0}, Wakeups));
+        results.push_back(MeasureGateway("Gateway/roundtrip", options.matchingCpu_, Wakeups));
+    }
+
+    for (auto& result : results)
+        Report(result);
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include "feed_handler.hpp"
+#include <algorithm>
+
+FeedHandler::FeedHandler(std::uint32_t priceScale, const std::vector<std::string>& symbols)
+: priceScale_{priceScale}
+, filter_{symbols.begin(), symbols.end()}
+, locateStates_(MaxLocates, LocateState::Unknown)
+, locates_(MaxLocates)
+{}
+
+std::size_t FeedHandler::Apply(const std::uint8_t* data, std::size_t size)
+{
+    return Itch::ForEachMessage(data, size, [this](const Itch::MessageView& message) { Apply(message); });
+}
+
+void FeedHandler::Apply(const Itch::MessageView& message)
+{
+    ++statistics_.messages_;
+
+    // The size a type needs before its fields can be read, 0 for types the books do not use
+    std::size_t size = 0;
+    switch (message.Type()) {
+        case 'A': case 'F': size = Itch::AddOrderSize; break;
+        case 'E': case 'C': size = Itch::OrderExecutedSize; break;
+        case 'X': size = Itch::OrderCancelSize; break;
+        case 'D': size = Itch::OrderDeleteSize; break;
+        case 'U': size = Itch::OrderReplaceSize; break;
+        case 'P': ++statistics_.trades_; return;
+        default: break;
+    }
+    if (size == 0) {
+        ++statistics_.ignored_;
+        return;
+    }
+    if (!message.HasSize(size)) {
+        ++statistics_.malformed_;
+        return;
+    }
+
+    if (message.Type() == 'A' || message.Type() == 'F') {
+        const Itch::AddOrderView add{message};
+        auto* symbol = Track(add.Locate(), add.Stock());
+        if (!symbol) {
+            ++statistics_.ignored_;
+            return;
+        }
+        ++statistics_.adds_;
+        Add(*symbol, add.GetOrderId(), add.GetSide(), add.Shares(), add.Price());
+        return;
+    }
+
+    auto* symbol = Find(message.Locate());
+    if (!symbol) {
+        ++statistics_.ignored_;
+        return;
+    }
+
+    switch (message.Type()) {
+        case 'E': case 'C': {
+            const Itch::OrderExecutedView execution{message};
+            ++statistics_.executions_;
+            Execute(*symbol, execution.GetOrderId(), execution.Shares());
+            break;
+        }
+        case 'X': {
+            const Itch::OrderCancelView cancel{message};
+            ++statistics_.cancels_;
+            auto order = symbol->orders_.find(cancel.GetOrderId());
+            if (order == symbol->orders_.end())
+                ++statistics_.unknownOrders_;
+            else
+                Reduce(*symbol, cancel.GetOrderId(), order->second, cancel.Shares());
+            break;
+        }
+        case 'D':
+            ++statistics_.deletes_;
+            Delete(*symbol, Itch::OrderDeleteView{message}.GetOrderId());
+            break;
+        case 'U': {
+            const Itch::OrderReplaceView replace{message};
+            ++statistics_.replaces_;
+            auto order = symbol->orders_.find(replace.GetOriginalOrderId());
+            if (order == symbol->orders_.end()) {
+                ++statistics_.unknownOrders_;
+                break;
+            }
+            const auto side = order->second.side_;
+            Delete(*symbol, replace.GetOriginalOrderId());
+            Add(*symbol, replace.GetNewOrderId(), side, replace.Shares(), replace.Price());
+            break;
+        }
+    }
+}
+
+const FeedHandler::Symbol* FeedHandler::FindSymbol(const std::string& name) const
+{
+    auto symbol = std::find_if(symbols_.begin(), symbols_.end(), [&name](const Symbol* symbol) { return symbol->name_ == name; });
+    return symbol == symbols_.end() ? nullptr : *symbol;
+}
+
+FeedHandler::Symbol* FeedHandler::Track(std::uint16_t locate, std::string_view stock)
+{
+    switch (locateStates_[locate]) {
+        case LocateState::Tracked:
+            return Find(locate);
+        case LocateState::Ignored:
+            return nullptr;
+        case LocateState::Unknown:
+            break;
+    }
+
+    std::string name{stock};
+    if (!filter_.empty() && filter_.find(name) == filter_.end()) {
+        locateStates_[locate] = LocateState::Ignored;
+        return nullptr;
+    }
+
+    locateStates_[locate] = LocateState::Tracked;
+    locates_[locate] = std::make_unique<Symbol>(Symbol{std::move(name), std::make_unique<OrderBook>(), {}});
+    symbols_.push_back(locates_[locate].get());
+    return symbols_.back();
+}
+
+void FeedHandler::Add(Symbol& symbol, OrderId orderId, Side side, std::uint32_t shares, std::uint32_t price)
+{
+    if (symbol.orders_.find(orderId) != symbol.orders_.end()) {
+        ++statistics_.duplicateOrders_;
+        return;
+    }
+
+    auto ticks = static_cast<Price>(price / priceScale_);
+    if (price % priceScale_ != 0) {
+        ++statistics_.subTickPrices_;
+        if (side == Side::Sell)
+            ++ticks;
+    }
+    symbol.orders_.emplace(orderId, RestingOrder{side, ticks, shares, 0});
+    const auto trades = symbol.book_->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, orderId, side, ticks, shares));
+
+    for (const auto& trade : trades) {
+        statistics_.crossedShares_ += trade.getBidTrade().quantity_;
+        for (const auto& info : {trade.getBidTrade(), trade.geAskTrade()}) {
+            auto& order = symbol.orders_.at(info.orderId_);
+            order.quantity_ -= info.quantity_;
+            order.credit_ += info.quantity_;
+        }
+    }
+}
+
+void FeedHandler::Execute(Symbol& symbol, OrderId orderId, std::uint32_t shares)
+{
+    auto found = symbol.orders_.find(orderId);
+    if (found == symbol.orders_.end()) {
+        ++statistics_.unknownOrders_;
+        return;
+    }
+
+    auto& order = found->second;
+    const auto credited = std::min<Quantity>(order.credit_, shares);
+    order.credit_ -= credited;
+    if (shares > credited)
+        Reduce(symbol, orderId, order, shares - credited);
+    else if (order.quantity_ == 0 && order.credit_ == 0)
+        symbol.orders_.erase(found);
+}
+
+void FeedHandler::Reduce(Symbol& symbol, OrderId orderId, RestingOrder& order, std::uint32_t shares)
+{
+    // Less than everything is an amend, which keeps the order's place in its level
+    if (shares >= order.quantity_) {
+        symbol.book_->CancelOrder(orderId);
+        order.quantity_ = 0;
+    }
+    else {
+        order.quantity_ -= shares;
+        symbol.book_->Match(OrderModify{orderId, order.side_, order.price_, order.quantity_});
+    }
+
+    if (order.quantity_ == 0 && order.credit_ == 0)
+        symbol.orders_.erase(orderId);
+}
+
+void FeedHandler::Delete(Symbol& symbol, OrderId orderId)
+{
+    auto order = symbol.orders_.find(orderId);
+    if (order == symbol.orders_.end()) {
+        ++statistics_.unknownOrders_;
+        return;
+    }
+
+    if (order->second.quantity_ > 0)
+        symbol.book_->CancelOrder(orderId);
+    symbol.orders_.erase(order);
+}
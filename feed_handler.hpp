@@ -0,0 +1,90 @@
+#pragma once
+#include "itch_format.hpp"
+#include "order_book.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Order by order (L3) feed handler: rebuilds one OrderBook per symbol from an ITCH stream (itch_format.hpp),
+ * adds, executions, cancels, deletes and replaces, so real exchange days can be replayed through the engine.
+ * Prices become ticks of priceScale ten-thousandths, 100 for cents. A price between ticks (sub-penny quotes under
+ * 1.00 in cents) is counted and rounded away from the spread, bids down and asks up, so it cannot cross the book.
+ *
+ * The rebuilt books match like any other. A continuous exchange book never crosses, but orders entered during
+ * an auction can, and a rebuilt book trades them as they arrive. Those fills are held against the orders as
+ * credit and the executions the feed reports at the uncross use it up first, instead of taking the shares twice.
+ * The orders that remain after an uncross can still differ, the feed does not say how the auction allocated.
+ */
+class FeedHandler
+{
+    public:
+        struct Statistics {
+            std::uint64_t messages_ {};
+            std::uint64_t adds_ {};
+            std::uint64_t executions_ {};
+            std::uint64_t cancels_ {};
+            std::uint64_t deletes_ {};
+            std::uint64_t replaces_ {};
+            std::uint64_t trades_ {};
+            std::uint64_t ignored_ {};          // Types without an effect on the book, or of symbols left out
+            std::uint64_t malformed_ {};        // Frames too short for their type
+            std::uint64_t unknownOrders_ {};    // Messages for an order that is not in the book
+            std::uint64_t duplicateOrders_ {};  // Adds of an order that already is
+            std::uint64_t crossedShares_ {};    // Shares the rebuilt books executed on an add
+            std::uint64_t subTickPrices_ {};    // Adds priced between two ticks, rounded away from the spread
+        };
+
+        // What the handler knows of one resting order, the book only takes modifications with side and price
+        struct RestingOrder {
+            Side side_;
+            Price price_;
+            Quantity quantity_;  // Left in the book
+            Quantity credit_;    // Executed by the book ahead of the feed
+        };
+
+        struct Symbol {
+            std::string name_;
+            std::unique_ptr<OrderBook> book_;
+            std::unordered_map<OrderId, RestingOrder> orders_;
+        };
+
+        // Books for symbols only, or for every symbol when it is empty
+        explicit FeedHandler(std::uint32_t priceScale = 100, const std::vector<std::string>& symbols = {});
+
+        // Apply the complete frames of [data, data + size) and return the bytes used, see Itch::ForEachMessage
+        std::size_t Apply(const std::uint8_t* data, std::size_t size);
+        void Apply(const Itch::MessageView& message);
+
+        const Statistics& GetStatistics() const { return statistics_; }
+        // Symbols with a book, in the order their first order arrived
+        const std::vector<Symbol*>& GetSymbols() const { return symbols_; }
+        // nullptr if the symbol has no book
+        const Symbol* FindSymbol(const std::string& name) const;
+
+    private:
+        static constexpr std::size_t MaxLocates = 1 << 16;
+
+        // Books indexed by stock locate. Locates are checked against the symbol filter once
+        enum class LocateState : std::uint8_t { Unknown, Tracked, Ignored };
+
+        std::uint32_t priceScale_;
+        std::unordered_set<std::string> filter_;
+        std::vector<LocateState> locateStates_;
+        std::vector<std::unique_ptr<Symbol>> locates_;
+        std::vector<Symbol*> symbols_;
+        Statistics statistics_;
+
+        // The book of message's locate, nullptr if it has none. The stock of an add opens it
+        Symbol* Track(std::uint16_t locate, std::string_view stock);
+        Symbol* Find(std::uint16_t locate) const { return locates_[locate].get(); }
+        void Add(Symbol& symbol, OrderId orderId, Side side, std::uint32_t shares, std::uint32_t price);
+        void Execute(Symbol& symbol, OrderId orderId, std::uint32_t shares);
+        // Take shares off an order without a trade, removing it once nothing is left
+        void Reduce(Symbol& symbol, OrderId orderId, RestingOrder& order, std::uint32_t shares);
+        void Delete(Symbol& symbol, OrderId orderId);
+};
@@ -1,172 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: orderbook.proto
-
-#include "orderbook.pb.h"
-#include "orderbook.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-namespace orderbook {
-
-static const char* OrderBookService_method_names[] = {
-  "/orderbook.OrderBookService/AddOrder",
-  "/orderbook.OrderBookService/CancelOrder",
-  "/orderbook.OrderBookService/GetOrderBook",
-};
-
-std::unique_ptr< OrderBookService::Stub> OrderBookService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< OrderBookService::Stub> stub(new OrderBookService::Stub(channel, options));
-  return stub;
-}
-
-OrderBookService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_AddOrder_(OrderBookService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CancelOrder_(OrderBookService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetOrderBook_(OrderBookService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  {}
-
-::grpc::Status OrderBookService::Stub::AddOrder(::grpc::ClientContext* context, const ::orderbook::AddOrderRequest& request, ::orderbook::OrderResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orderbook::AddOrderRequest, ::orderbook::OrderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_AddOrder_, context, request, response);
-}
-
-void OrderBookService::Stub::async::AddOrder(::grpc::ClientContext* context, const ::orderbook::AddOrderRequest* request, ::orderbook::OrderResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orderbook::AddOrderRequest, ::orderbook::OrderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_AddOrder_, context, request, response, std::move(f));
-}
-
-void OrderBookService::Stub::async::AddOrder(::grpc::ClientContext* context, const ::orderbook::AddOrderRequest* request, ::orderbook::OrderResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_AddOrder_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orderbook::OrderResponse>* OrderBookService::Stub::PrepareAsyncAddOrderRaw(::grpc::ClientContext* context, const ::orderbook::AddOrderRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orderbook::OrderResponse, ::orderbook::AddOrderRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_AddOrder_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orderbook::OrderResponse>* OrderBookService::Stub::AsyncAddOrderRaw(::grpc::ClientContext* context, const ::orderbook::AddOrderRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncAddOrderRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status OrderBookService::Stub::CancelOrder(::grpc::ClientContext* context, const ::orderbook::CancelOrderRequest& request, ::orderbook::OrderResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orderbook::CancelOrderRequest, ::orderbook::OrderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_CancelOrder_, context, request, response);
-}
-
-void OrderBookService::Stub::async::CancelOrder(::grpc::ClientContext* context, const ::orderbook::CancelOrderRequest* request, ::orderbook::OrderResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orderbook::CancelOrderRequest, ::orderbook::OrderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CancelOrder_, context, request, response, std::move(f));
-}
-
-void OrderBookService::Stub::async::CancelOrder(::grpc::ClientContext* context, const ::orderbook::CancelOrderRequest* request, ::orderbook::OrderResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CancelOrder_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orderbook::OrderResponse>* OrderBookService::Stub::PrepareAsyncCancelOrderRaw(::grpc::ClientContext* context, const ::orderbook::CancelOrderRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orderbook::OrderResponse, ::orderbook::CancelOrderRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_CancelOrder_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orderbook::OrderResponse>* OrderBookService::Stub::AsyncCancelOrderRaw(::grpc::ClientContext* context, const ::orderbook::CancelOrderRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncCancelOrderRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status OrderBookService::Stub::GetOrderBook(::grpc::ClientContext* context, const ::orderbook::GetOrderBookRequest& request, ::orderbook::OrderBookResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::orderbook::GetOrderBookRequest, ::orderbook::OrderBookResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetOrderBook_, context, request, response);
-}
-
-void OrderBookService::Stub::async::GetOrderBook(::grpc::ClientContext* context, const ::orderbook::GetOrderBookRequest* request, ::orderbook::OrderBookResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::orderbook::GetOrderBookRequest, ::orderbook::OrderBookResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetOrderBook_, context, request, response, std::move(f));
-}
-
-void OrderBookService::Stub::async::GetOrderBook(::grpc::ClientContext* context, const ::orderbook::GetOrderBookRequest* request, ::orderbook::OrderBookResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetOrderBook_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::orderbook::OrderBookResponse>* OrderBookService::Stub::PrepareAsyncGetOrderBookRaw(::grpc::ClientContext* context, const ::orderbook::GetOrderBookRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::orderbook::OrderBookResponse, ::orderbook::GetOrderBookRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetOrderBook_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::orderbook::OrderBookResponse>* OrderBookService::Stub::AsyncGetOrderBookRaw(::grpc::ClientContext* context, const ::orderbook::GetOrderBookRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetOrderBookRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-OrderBookService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      OrderBookService_method_names[0],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< OrderBookService::Service, ::orderbook::AddOrderRequest, ::orderbook::OrderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](OrderBookService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orderbook::AddOrderRequest* req,
-             ::orderbook::OrderResponse* resp) {
-               return service->AddOrder(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      OrderBookService_method_names[1],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< OrderBookService::Service, ::orderbook::CancelOrderRequest, ::orderbook::OrderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](OrderBookService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orderbook::CancelOrderRequest* req,
-             ::orderbook::OrderResponse* resp) {
-               return service->CancelOrder(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      OrderBookService_method_names[2],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< OrderBookService::Service, ::orderbook::GetOrderBookRequest, ::orderbook::OrderBookResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](OrderBookService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::orderbook::GetOrderBookRequest* req,
-             ::orderbook::OrderBookResponse* resp) {
-               return service->GetOrderBook(ctx, req, resp);
-             }, this)));
-}
-
-OrderBookService::Service::~Service() {
-}
-
-::grpc::Status OrderBookService::Service::AddOrder(::grpc::ServerContext* context, const ::orderbook::AddOrderRequest* request, ::orderbook::OrderResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status OrderBookService::Service::CancelOrder(::grpc::ServerContext* context, const ::orderbook::CancelOrderRequest* request, ::orderbook::OrderResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status OrderBookService::Service::GetOrderBook(::grpc::ServerContext* context, const ::orderbook::GetOrderBookRequest* request, ::orderbook::OrderBookResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace orderbook
-#include <grpcpp/ports_undef.inc>
-
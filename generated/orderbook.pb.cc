@@ -1,1749 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: orderbook.proto
-// Protobuf C++ Version: 5.29.3
-
-#include "orderbook.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace orderbook {
-
-inline constexpr PriceLevel::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : price_{0},
-        quantity_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR PriceLevel::PriceLevel(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct PriceLevelDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PriceLevelDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PriceLevelDefaultTypeInternal() {}
-  union {
-    PriceLevel _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
-
-inline constexpr OrderResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        success_{false},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR OrderResponse::OrderResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct OrderResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OrderResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~OrderResponseDefaultTypeInternal() {}
-  union {
-    OrderResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderResponseDefaultTypeInternal _OrderResponse_default_instance_;
-              template <typename>
-PROTOBUF_CONSTEXPR GetOrderBookRequest::GetOrderBookRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::internal::ZeroFieldsBase(_class_data_.base()){}
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::internal::ZeroFieldsBase() {
-}
-#endif  // PROTOBUF_CUSTOM_VTABLE
-struct GetOrderBookRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetOrderBookRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetOrderBookRequestDefaultTypeInternal() {}
-  union {
-    GetOrderBookRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetOrderBookRequestDefaultTypeInternal _GetOrderBookRequest_default_instance_;
-
-inline constexpr CancelOrderRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : order_id_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CancelOrderRequest::CancelOrderRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CancelOrderRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CancelOrderRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CancelOrderRequestDefaultTypeInternal() {}
-  union {
-    CancelOrderRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelOrderRequestDefaultTypeInternal _CancelOrderRequest_default_instance_;
-
-inline constexpr AddOrderRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : side_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_id_{0},
-        quantity_{0},
-        price_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AddOrderRequest::AddOrderRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AddOrderRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AddOrderRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AddOrderRequestDefaultTypeInternal() {}
-  union {
-    AddOrderRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AddOrderRequestDefaultTypeInternal _AddOrderRequest_default_instance_;
-
-inline constexpr OrderBookResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : bids_{},
-        asks_{},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR OrderBookResponse::OrderBookResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct OrderBookResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OrderBookResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~OrderBookResponseDefaultTypeInternal() {}
-  union {
-    OrderBookResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderBookResponseDefaultTypeInternal _OrderBookResponse_default_instance_;
-}  // namespace orderbook
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_orderbook_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_orderbook_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_orderbook_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::orderbook::AddOrderRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::orderbook::AddOrderRequest, _impl_.order_id_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::AddOrderRequest, _impl_.side_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::AddOrderRequest, _impl_.price_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::AddOrderRequest, _impl_.quantity_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::AddOrderRequest, _impl_.order_type_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::orderbook::CancelOrderRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::orderbook::CancelOrderRequest, _impl_.order_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::orderbook::GetOrderBookRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::orderbook::OrderResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::orderbook::OrderResponse, _impl_.message_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::OrderResponse, _impl_.success_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::orderbook::OrderBookResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::orderbook::OrderBookResponse, _impl_.bids_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::OrderBookResponse, _impl_.asks_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::orderbook::PriceLevel, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::orderbook::PriceLevel, _impl_.price_),
-        PROTOBUF_FIELD_OFFSET(::orderbook::PriceLevel, _impl_.quantity_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::orderbook::AddOrderRequest)},
-        {13, -1, -1, sizeof(::orderbook::CancelOrderRequest)},
-        {22, -1, -1, sizeof(::orderbook::GetOrderBookRequest)},
-        {30, -1, -1, sizeof(::orderbook::OrderResponse)},
-        {40, -1, -1, sizeof(::orderbook::OrderBookResponse)},
-        {50, -1, -1, sizeof(::orderbook::PriceLevel)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::orderbook::_AddOrderRequest_default_instance_._instance,
-    &::orderbook::_CancelOrderRequest_default_instance_._instance,
-    &::orderbook::_GetOrderBookRequest_default_instance_._instance,
-    &::orderbook::_OrderResponse_default_instance_._instance,
-    &::orderbook::_OrderBookResponse_default_instance_._instance,
-    &::orderbook::_PriceLevel_default_instance_._instance,
-};
-const char descriptor_table_protodef_orderbook_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\017orderbook.proto\022\torderbook\"f\n\017AddOrder"
-    "Request\022\020\n\010order_id\030\001 \001(\005\022\014\n\004side\030\002 \001(\t\022"
-    "\r\n\005price\030\003 \001(\001\022\020\n\010quantity\030\004 \001(\005\022\022\n\norde"
-    "r_type\030\005 \001(\t\"&\n\022CancelOrderRequest\022\020\n\010or"
-    "der_id\030\001 \001(\005\"\025\n\023GetOrderBookRequest\"1\n\rO"
-    "rderResponse\022\017\n\007message\030\001 \001(\t\022\017\n\007success"
-    "\030\002 \001(\010\"]\n\021OrderBookResponse\022#\n\004bids\030\001 \003("
-    "\0132\025.orderbook.PriceLevel\022#\n\004asks\030\002 \003(\0132\025"
-    ".orderbook.PriceLevel\"-\n\nPriceLevel\022\r\n\005p"
-    "rice\030\001 \001(\001\022\020\n\010quantity\030\002 \001(\0052\352\001\n\020OrderBo"
-    "okService\022@\n\010AddOrder\022\032.orderbook.AddOrd"
-    "erRequest\032\030.orderbook.OrderResponse\022F\n\013C"
-    "ancelOrder\022\035.orderbook.CancelOrderReques"
-    "t\032\030.orderbook.OrderResponse\022L\n\014GetOrderB"
-    "ook\022\036.orderbook.GetOrderBookRequest\032\034.or"
-    "derbook.OrderBookResponseb\006proto3"
-};
-static ::absl::once_flag descriptor_table_orderbook_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_orderbook_2eproto = {
-    false,
-    false,
-    633,
-    descriptor_table_protodef_orderbook_2eproto,
-    "orderbook.proto",
-    &descriptor_table_orderbook_2eproto_once,
-    nullptr,
-    0,
-    6,
-    schemas,
-    file_default_instances,
-    TableStruct_orderbook_2eproto::offsets,
-    file_level_enum_descriptors_orderbook_2eproto,
-    file_level_service_descriptors_orderbook_2eproto,
-};
-namespace orderbook {
-// ===================================================================
-
-class AddOrderRequest::_Internal {
- public:
-};
-
-AddOrderRequest::AddOrderRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:orderbook.AddOrderRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE AddOrderRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::orderbook::AddOrderRequest& from_msg)
-      : side_(arena, from.side_),
-        order_type_(arena, from.order_type_),
-        _cached_size_{0} {}
-
-AddOrderRequest::AddOrderRequest(
-    ::google::protobuf::Arena* arena,
-    const AddOrderRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AddOrderRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, order_id_),
-           offsetof(Impl_, price_) -
-               offsetof(Impl_, order_id_) +
-               sizeof(Impl_::price_));
-
-  // @@protoc_insertion_point(copy_constructor:orderbook.AddOrderRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE AddOrderRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : side_(arena),
-        order_type_(arena),
-        _cached_size_{0} {}
-
-inline void AddOrderRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_id_),
-           0,
-           offsetof(Impl_, price_) -
-               offsetof(Impl_, order_id_) +
-               sizeof(Impl_::price_));
-}
-AddOrderRequest::~AddOrderRequest() {
-  // @@protoc_insertion_point(destructor:orderbook.AddOrderRequest)
-  SharedDtor(*this);
-}
-inline void AddOrderRequest::SharedDtor(MessageLite& self) {
-  AddOrderRequest& this_ = static_cast<AddOrderRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.side_.Destroy();
-  this_._impl_.order_type_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* AddOrderRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AddOrderRequest(arena);
-}
-constexpr auto AddOrderRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AddOrderRequest),
-                                            alignof(AddOrderRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AddOrderRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AddOrderRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AddOrderRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AddOrderRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AddOrderRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AddOrderRequest>(), &AddOrderRequest::ByteSizeLong,
-            &AddOrderRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_._cached_size_),
-        false,
-    },
-    &AddOrderRequest::kDescriptorMethods,
-    &descriptor_table_orderbook_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AddOrderRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 48, 2> AddOrderRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::orderbook::AddOrderRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 order_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddOrderRequest, _impl_.order_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.order_id_)}},
-    // string side = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.side_)}},
-    // double price = 3;
-    {::_pbi::TcParser::FastF64S1,
-     {25, 63, 0, PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.price_)}},
-    // int32 quantity = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AddOrderRequest, _impl_.quantity_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.quantity_)}},
-    // string order_type = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.order_type_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 order_id = 1;
-    {PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.order_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string side = 2;
-    {PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.side_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double price = 3;
-    {PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // int32 quantity = 4;
-    {PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.quantity_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string order_type = 5;
-    {PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\31\0\4\0\0\12\0\0"
-    "orderbook.AddOrderRequest"
-    "side"
-    "order_type"
-  }},
-};
-
-PROTOBUF_NOINLINE void AddOrderRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:orderbook.AddOrderRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.side_.ClearToEmpty();
-  _impl_.order_type_.ClearToEmpty();
-  ::memset(&_impl_.order_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.price_) -
-      reinterpret_cast<char*>(&_impl_.order_id_)) + sizeof(_impl_.price_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AddOrderRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AddOrderRequest& this_ = static_cast<const AddOrderRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AddOrderRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AddOrderRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:orderbook.AddOrderRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 order_id = 1;
-          if (this_._internal_order_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_order_id(), target);
-          }
-
-          // string side = 2;
-          if (!this_._internal_side().empty()) {
-            const std::string& _s = this_._internal_side();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "orderbook.AddOrderRequest.side");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // double price = 3;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                3, this_._internal_price(), target);
-          }
-
-          // int32 quantity = 4;
-          if (this_._internal_quantity() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_quantity(), target);
-          }
-
-          // string order_type = 5;
-          if (!this_._internal_order_type().empty()) {
-            const std::string& _s = this_._internal_order_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "orderbook.AddOrderRequest.order_type");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:orderbook.AddOrderRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AddOrderRequest::ByteSizeLong(const MessageLite& base) {
-          const AddOrderRequest& this_ = static_cast<const AddOrderRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AddOrderRequest::ByteSizeLong() const {
-          const AddOrderRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:orderbook.AddOrderRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string side = 2;
-            if (!this_._internal_side().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_side());
-            }
-            // string order_type = 5;
-            if (!this_._internal_order_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_order_type());
-            }
-            // int32 order_id = 1;
-            if (this_._internal_order_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_id());
-            }
-            // int32 quantity = 4;
-            if (this_._internal_quantity() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_quantity());
-            }
-            // double price = 3;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AddOrderRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AddOrderRequest*>(&to_msg);
-  auto& from = static_cast<const AddOrderRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:orderbook.AddOrderRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_side().empty()) {
-    _this->_internal_set_side(from._internal_side());
-  }
-  if (!from._internal_order_type().empty()) {
-    _this->_internal_set_order_type(from._internal_order_type());
-  }
-  if (from._internal_order_id() != 0) {
-    _this->_impl_.order_id_ = from._impl_.order_id_;
-  }
-  if (from._internal_quantity() != 0) {
-    _this->_impl_.quantity_ = from._impl_.quantity_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_price()) != 0) {
-    _this->_impl_.price_ = from._impl_.price_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AddOrderRequest::CopyFrom(const AddOrderRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:orderbook.AddOrderRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AddOrderRequest::InternalSwap(AddOrderRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.side_, &other->_impl_.side_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.order_type_, &other->_impl_.order_type_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.price_)
-      + sizeof(AddOrderRequest::_impl_.price_)
-      - PROTOBUF_FIELD_OFFSET(AddOrderRequest, _impl_.order_id_)>(
-          reinterpret_cast<char*>(&_impl_.order_id_),
-          reinterpret_cast<char*>(&other->_impl_.order_id_));
-}
-
-::google::protobuf::Metadata AddOrderRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CancelOrderRequest::_Internal {
- public:
-};
-
-CancelOrderRequest::CancelOrderRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:orderbook.CancelOrderRequest)
-}
-CancelOrderRequest::CancelOrderRequest(
-    ::google::protobuf::Arena* arena, const CancelOrderRequest& from)
-    : CancelOrderRequest(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE CancelOrderRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void CancelOrderRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.order_id_ = {};
-}
-CancelOrderRequest::~CancelOrderRequest() {
-  // @@protoc_insertion_point(destructor:orderbook.CancelOrderRequest)
-  SharedDtor(*this);
-}
-inline void CancelOrderRequest::SharedDtor(MessageLite& self) {
-  CancelOrderRequest& this_ = static_cast<CancelOrderRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* CancelOrderRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CancelOrderRequest(arena);
-}
-constexpr auto CancelOrderRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(CancelOrderRequest),
-                                            alignof(CancelOrderRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CancelOrderRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CancelOrderRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CancelOrderRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CancelOrderRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CancelOrderRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CancelOrderRequest>(), &CancelOrderRequest::ByteSizeLong,
-            &CancelOrderRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CancelOrderRequest, _impl_._cached_size_),
-        false,
-    },
-    &CancelOrderRequest::kDescriptorMethods,
-    &descriptor_table_orderbook_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CancelOrderRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> CancelOrderRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::orderbook::CancelOrderRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 order_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CancelOrderRequest, _impl_.order_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CancelOrderRequest, _impl_.order_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 order_id = 1;
-    {PROTOBUF_FIELD_OFFSET(CancelOrderRequest, _impl_.order_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void CancelOrderRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:orderbook.CancelOrderRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.order_id_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CancelOrderRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CancelOrderRequest& this_ = static_cast<const CancelOrderRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CancelOrderRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CancelOrderRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:orderbook.CancelOrderRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 order_id = 1;
-          if (this_._internal_order_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_order_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:orderbook.CancelOrderRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CancelOrderRequest::ByteSizeLong(const MessageLite& base) {
-          const CancelOrderRequest& this_ = static_cast<const CancelOrderRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CancelOrderRequest::ByteSizeLong() const {
-          const CancelOrderRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:orderbook.CancelOrderRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // int32 order_id = 1;
-            if (this_._internal_order_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CancelOrderRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CancelOrderRequest*>(&to_msg);
-  auto& from = static_cast<const CancelOrderRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:orderbook.CancelOrderRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_order_id() != 0) {
-    _this->_impl_.order_id_ = from._impl_.order_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CancelOrderRequest::CopyFrom(const CancelOrderRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:orderbook.CancelOrderRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CancelOrderRequest::InternalSwap(CancelOrderRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.order_id_, other->_impl_.order_id_);
-}
-
-::google::protobuf::Metadata CancelOrderRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetOrderBookRequest::_Internal {
- public:
-};
-
-GetOrderBookRequest::GetOrderBookRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(arena_constructor:orderbook.GetOrderBookRequest)
-}
-GetOrderBookRequest::GetOrderBookRequest(
-    ::google::protobuf::Arena* arena,
-    const GetOrderBookRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetOrderBookRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
-  // @@protoc_insertion_point(copy_constructor:orderbook.GetOrderBookRequest)
-}
-
-inline void* GetOrderBookRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetOrderBookRequest(arena);
-}
-constexpr auto GetOrderBookRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetOrderBookRequest),
-                                            alignof(GetOrderBookRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetOrderBookRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetOrderBookRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetOrderBookRequest::MergeImpl,
-        ::google::protobuf::internal::ZeroFieldsBase::GetNewImpl<GetOrderBookRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetOrderBookRequest::SharedDtor,
-        ::google::protobuf::internal::ZeroFieldsBase::GetClearImpl<GetOrderBookRequest>(), &GetOrderBookRequest::ByteSizeLong,
-            &GetOrderBookRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetOrderBookRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetOrderBookRequest::kDescriptorMethods,
-    &descriptor_table_orderbook_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetOrderBookRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 0, 0, 0, 2> GetOrderBookRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    0, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967295,  // skipmap
-    offsetof(decltype(_table_), field_names),  // no field_entries
-    0,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::orderbook::GetOrderBookRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }},
-  // no field_entries, or aux_entries
-  {{
-  }},
-};
-
-
-
-
-
-
-
-
-::google::protobuf::Metadata GetOrderBookRequest::GetMetadata() const {
-  return ::google::protobuf::internal::ZeroFieldsBase::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class OrderResponse::_Internal {
- public:
-};
-
-OrderResponse::OrderResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:orderbook.OrderResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE OrderResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::orderbook::OrderResponse& from_msg)
-      : message_(arena, from.message_),
-        _cached_size_{0} {}
-
-OrderResponse::OrderResponse(
-    ::google::protobuf::Arena* arena,
-    const OrderResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  OrderResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.success_ = from._impl_.success_;
-
-  // @@protoc_insertion_point(copy_constructor:orderbook.OrderResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE OrderResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : message_(arena),
-        _cached_size_{0} {}
-
-inline void OrderResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.success_ = {};
-}
-OrderResponse::~OrderResponse() {
-  // @@protoc_insertion_point(destructor:orderbook.OrderResponse)
-  SharedDtor(*this);
-}
-inline void OrderResponse::SharedDtor(MessageLite& self) {
-  OrderResponse& this_ = static_cast<OrderResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.message_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* OrderResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) OrderResponse(arena);
-}
-constexpr auto OrderResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(OrderResponse),
-                                            alignof(OrderResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull OrderResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_OrderResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &OrderResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<OrderResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &OrderResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<OrderResponse>(), &OrderResponse::ByteSizeLong,
-            &OrderResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_._cached_size_),
-        false,
-    },
-    &OrderResponse::kDescriptorMethods,
-    &descriptor_table_orderbook_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* OrderResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 39, 2> OrderResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::orderbook::OrderResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // bool success = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(OrderResponse, _impl_.success_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.success_)}},
-    // string message = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.message_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string message = 1;
-    {PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.message_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // bool success = 2;
-    {PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.success_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }},
-  // no aux_entries
-  {{
-    "\27\7\0\0\0\0\0\0"
-    "orderbook.OrderResponse"
-    "message"
-  }},
-};
-
-PROTOBUF_NOINLINE void OrderResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:orderbook.OrderResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.message_.ClearToEmpty();
-  _impl_.success_ = false;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* OrderResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const OrderResponse& this_ = static_cast<const OrderResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* OrderResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const OrderResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:orderbook.OrderResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string message = 1;
-          if (!this_._internal_message().empty()) {
-            const std::string& _s = this_._internal_message();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "orderbook.OrderResponse.message");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // bool success = 2;
-          if (this_._internal_success() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                2, this_._internal_success(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:orderbook.OrderResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t OrderResponse::ByteSizeLong(const MessageLite& base) {
-          const OrderResponse& this_ = static_cast<const OrderResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t OrderResponse::ByteSizeLong() const {
-          const OrderResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:orderbook.OrderResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string message = 1;
-            if (!this_._internal_message().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_message());
-            }
-            // bool success = 2;
-            if (this_._internal_success() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void OrderResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<OrderResponse*>(&to_msg);
-  auto& from = static_cast<const OrderResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:orderbook.OrderResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
-  }
-  if (from._internal_success() != 0) {
-    _this->_impl_.success_ = from._impl_.success_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void OrderResponse::CopyFrom(const OrderResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:orderbook.OrderResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void OrderResponse::InternalSwap(OrderResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
-        swap(_impl_.success_, other->_impl_.success_);
-}
-
-::google::protobuf::Metadata OrderResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class OrderBookResponse::_Internal {
- public:
-};
-
-OrderBookResponse::OrderBookResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:orderbook.OrderBookResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE OrderBookResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::orderbook::OrderBookResponse& from_msg)
-      : bids_{visibility, arena, from.bids_},
-        asks_{visibility, arena, from.asks_},
-        _cached_size_{0} {}
-
-OrderBookResponse::OrderBookResponse(
-    ::google::protobuf::Arena* arena,
-    const OrderBookResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  OrderBookResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:orderbook.OrderBookResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE OrderBookResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : bids_{visibility, arena},
-        asks_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void OrderBookResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-OrderBookResponse::~OrderBookResponse() {
-  // @@protoc_insertion_point(destructor:orderbook.OrderBookResponse)
-  SharedDtor(*this);
-}
-inline void OrderBookResponse::SharedDtor(MessageLite& self) {
-  OrderBookResponse& this_ = static_cast<OrderBookResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* OrderBookResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) OrderBookResponse(arena);
-}
-constexpr auto OrderBookResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_.bids_) +
-          decltype(OrderBookResponse::_impl_.bids_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-      PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_.asks_) +
-          decltype(OrderBookResponse::_impl_.asks_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(OrderBookResponse), alignof(OrderBookResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&OrderBookResponse::PlacementNew_,
-                                 sizeof(OrderBookResponse),
-                                 alignof(OrderBookResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull OrderBookResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_OrderBookResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &OrderBookResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<OrderBookResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &OrderBookResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<OrderBookResponse>(), &OrderBookResponse::ByteSizeLong,
-            &OrderBookResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_._cached_size_),
-        false,
-    },
-    &OrderBookResponse::kDescriptorMethods,
-    &descriptor_table_orderbook_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* OrderBookResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> OrderBookResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::orderbook::OrderBookResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .orderbook.PriceLevel asks = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_.asks_)}},
-    // repeated .orderbook.PriceLevel bids = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_.bids_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .orderbook.PriceLevel bids = 1;
-    {PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_.bids_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .orderbook.PriceLevel asks = 2;
-    {PROTOBUF_FIELD_OFFSET(OrderBookResponse, _impl_.asks_), 0, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::orderbook::PriceLevel>()},
-    {::_pbi::TcParser::GetTable<::orderbook::PriceLevel>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void OrderBookResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:orderbook.OrderBookResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.bids_.Clear();
-  _impl_.asks_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* OrderBookResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const OrderBookResponse& this_ = static_cast<const OrderBookResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* OrderBookResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const OrderBookResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:orderbook.OrderBookResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .orderbook.PriceLevel bids = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_bids_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_bids().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // repeated .orderbook.PriceLevel asks = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_asks_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_asks().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:orderbook.OrderBookResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t OrderBookResponse::ByteSizeLong(const MessageLite& base) {
-          const OrderBookResponse& this_ = static_cast<const OrderBookResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t OrderBookResponse::ByteSizeLong() const {
-          const OrderBookResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:orderbook.OrderBookResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .orderbook.PriceLevel bids = 1;
-            {
-              total_size += 1UL * this_._internal_bids_size();
-              for (const auto& msg : this_._internal_bids()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-            // repeated .orderbook.PriceLevel asks = 2;
-            {
-              total_size += 1UL * this_._internal_asks_size();
-              for (const auto& msg : this_._internal_asks()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void OrderBookResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<OrderBookResponse*>(&to_msg);
-  auto& from = static_cast<const OrderBookResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:orderbook.OrderBookResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_bids()->MergeFrom(
-      from._internal_bids());
-  _this->_internal_mutable_asks()->MergeFrom(
-      from._internal_asks());
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void OrderBookResponse::CopyFrom(const OrderBookResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:orderbook.OrderBookResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void OrderBookResponse::InternalSwap(OrderBookResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.bids_.InternalSwap(&other->_impl_.bids_);
-  _impl_.asks_.InternalSwap(&other->_impl_.asks_);
-}
-
-::google::protobuf::Metadata OrderBookResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class PriceLevel::_Internal {
- public:
-};
-
-PriceLevel::PriceLevel(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:orderbook.PriceLevel)
-}
-PriceLevel::PriceLevel(
-    ::google::protobuf::Arena* arena, const PriceLevel& from)
-    : PriceLevel(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE PriceLevel::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void PriceLevel::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, price_),
-           0,
-           offsetof(Impl_, quantity_) -
-               offsetof(Impl_, price_) +
-               sizeof(Impl_::quantity_));
-}
-PriceLevel::~PriceLevel() {
-  // @@protoc_insertion_point(destructor:orderbook.PriceLevel)
-  SharedDtor(*this);
-}
-inline void PriceLevel::SharedDtor(MessageLite& self) {
-  PriceLevel& this_ = static_cast<PriceLevel&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* PriceLevel::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) PriceLevel(arena);
-}
-constexpr auto PriceLevel::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(PriceLevel),
-                                            alignof(PriceLevel));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull PriceLevel::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_PriceLevel_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &PriceLevel::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<PriceLevel>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &PriceLevel::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<PriceLevel>(), &PriceLevel::ByteSizeLong,
-            &PriceLevel::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_._cached_size_),
-        false,
-    },
-    &PriceLevel::kDescriptorMethods,
-    &descriptor_table_orderbook_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* PriceLevel::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2> PriceLevel::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::orderbook::PriceLevel>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 quantity = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(PriceLevel, _impl_.quantity_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_)}},
-    // double price = 1;
-    {::_pbi::TcParser::FastF64S1,
-     {9, 63, 0, PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // double price = 1;
-    {PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // int32 quantity = 2;
-    {PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void PriceLevel::Clear() {
-// @@protoc_insertion_point(message_clear_start:orderbook.PriceLevel)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.price_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.quantity_) -
-      reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.quantity_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* PriceLevel::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const PriceLevel& this_ = static_cast<const PriceLevel&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* PriceLevel::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const PriceLevel& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:orderbook.PriceLevel)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // double price = 1;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                1, this_._internal_price(), target);
-          }
-
-          // int32 quantity = 2;
-          if (this_._internal_quantity() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_quantity(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:orderbook.PriceLevel)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t PriceLevel::ByteSizeLong(const MessageLite& base) {
-          const PriceLevel& this_ = static_cast<const PriceLevel&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t PriceLevel::ByteSizeLong() const {
-          const PriceLevel& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:orderbook.PriceLevel)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // double price = 1;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-              total_size += 9;
-            }
-            // int32 quantity = 2;
-            if (this_._internal_quantity() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_quantity());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void PriceLevel::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<PriceLevel*>(&to_msg);
-  auto& from = static_cast<const PriceLevel&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:orderbook.PriceLevel)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (::absl::bit_cast<::uint64_t>(from._internal_price()) != 0) {
-    _this->_impl_.price_ = from._impl_.price_;
-  }
-  if (from._internal_quantity() != 0) {
-    _this->_impl_.quantity_ = from._impl_.quantity_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void PriceLevel::CopyFrom(const PriceLevel& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:orderbook.PriceLevel)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void PriceLevel::InternalSwap(PriceLevel* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.quantity_)
-      + sizeof(PriceLevel::_impl_.quantity_)
-      - PROTOBUF_FIELD_OFFSET(PriceLevel, _impl_.price_)>(
-          reinterpret_cast<char*>(&_impl_.price_),
-          reinterpret_cast<char*>(&other->_impl_.price_));
-}
-
-::google::protobuf::Metadata PriceLevel::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace orderbook
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_orderbook_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
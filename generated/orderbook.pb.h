@@ -1,1741 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: orderbook.proto
-// Protobuf C++ Version: 5.29.3
-
-#ifndef orderbook_2eproto_2epb_2eh
-#define orderbook_2eproto_2epb_2eh
-
-#include <limits>
-#include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 5029003
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_bases.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-
-#define PROTOBUF_INTERNAL_EXPORT_orderbook_2eproto
-
-namespace google {
-namespace protobuf {
-namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
-}  // namespace internal
-}  // namespace protobuf
-}  // namespace google
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_orderbook_2eproto {
-  static const ::uint32_t offsets[];
-};
-extern const ::google::protobuf::internal::DescriptorTable
-    descriptor_table_orderbook_2eproto;
-namespace orderbook {
-class AddOrderRequest;
-struct AddOrderRequestDefaultTypeInternal;
-extern AddOrderRequestDefaultTypeInternal _AddOrderRequest_default_instance_;
-class CancelOrderRequest;
-struct CancelOrderRequestDefaultTypeInternal;
-extern CancelOrderRequestDefaultTypeInternal _CancelOrderRequest_default_instance_;
-class GetOrderBookRequest;
-struct GetOrderBookRequestDefaultTypeInternal;
-extern GetOrderBookRequestDefaultTypeInternal _GetOrderBookRequest_default_instance_;
-class OrderBookResponse;
-struct OrderBookResponseDefaultTypeInternal;
-extern OrderBookResponseDefaultTypeInternal _OrderBookResponse_default_instance_;
-class OrderResponse;
-struct OrderResponseDefaultTypeInternal;
-extern OrderResponseDefaultTypeInternal _OrderResponse_default_instance_;
-class PriceLevel;
-struct PriceLevelDefaultTypeInternal;
-extern PriceLevelDefaultTypeInternal _PriceLevel_default_instance_;
-}  // namespace orderbook
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
-namespace orderbook {
-
-// ===================================================================
-
-
-// -------------------------------------------------------------------
-
-class PriceLevel final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:orderbook.PriceLevel) */ {
- public:
-  inline PriceLevel() : PriceLevel(nullptr) {}
-  ~PriceLevel() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PriceLevel* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PriceLevel));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PriceLevel(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline PriceLevel(const PriceLevel& from) : PriceLevel(nullptr, from) {}
-  inline PriceLevel(PriceLevel&& from) noexcept
-      : PriceLevel(nullptr, std::move(from)) {}
-  inline PriceLevel& operator=(const PriceLevel& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline PriceLevel& operator=(PriceLevel&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const PriceLevel& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const PriceLevel* internal_default_instance() {
-    return reinterpret_cast<const PriceLevel*>(
-        &_PriceLevel_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(PriceLevel& a, PriceLevel& b) { a.Swap(&b); }
-  inline void Swap(PriceLevel* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(PriceLevel* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  PriceLevel* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PriceLevel>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PriceLevel& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PriceLevel& from) { PriceLevel::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(PriceLevel* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "orderbook.PriceLevel"; }
-
- protected:
-  explicit PriceLevel(::google::protobuf::Arena* arena);
-  PriceLevel(::google::protobuf::Arena* arena, const PriceLevel& from);
-  PriceLevel(::google::protobuf::Arena* arena, PriceLevel&& from) noexcept
-      : PriceLevel(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPriceFieldNumber = 1,
-    kQuantityFieldNumber = 2,
-  };
-  // double price = 1;
-  void clear_price() ;
-  double price() const;
-  void set_price(double value);
-
-  private:
-  double _internal_price() const;
-  void _internal_set_price(double value);
-
-  public:
-  // int32 quantity = 2;
-  void clear_quantity() ;
-  ::int32_t quantity() const;
-  void set_quantity(::int32_t value);
-
-  private:
-  ::int32_t _internal_quantity() const;
-  void _internal_set_quantity(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:orderbook.PriceLevel)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const PriceLevel& from_msg);
-    double price_;
-    ::int32_t quantity_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_orderbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class OrderResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:orderbook.OrderResponse) */ {
- public:
-  inline OrderResponse() : OrderResponse(nullptr) {}
-  ~OrderResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(OrderResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR OrderResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline OrderResponse(const OrderResponse& from) : OrderResponse(nullptr, from) {}
-  inline OrderResponse(OrderResponse&& from) noexcept
-      : OrderResponse(nullptr, std::move(from)) {}
-  inline OrderResponse& operator=(const OrderResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline OrderResponse& operator=(OrderResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const OrderResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const OrderResponse* internal_default_instance() {
-    return reinterpret_cast<const OrderResponse*>(
-        &_OrderResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(OrderResponse& a, OrderResponse& b) { a.Swap(&b); }
-  inline void Swap(OrderResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(OrderResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  OrderResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<OrderResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OrderResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const OrderResponse& from) { OrderResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(OrderResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "orderbook.OrderResponse"; }
-
- protected:
-  explicit OrderResponse(::google::protobuf::Arena* arena);
-  OrderResponse(::google::protobuf::Arena* arena, const OrderResponse& from);
-  OrderResponse(::google::protobuf::Arena* arena, OrderResponse&& from) noexcept
-      : OrderResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kMessageFieldNumber = 1,
-    kSuccessFieldNumber = 2,
-  };
-  // string message = 1;
-  void clear_message() ;
-  const std::string& message() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_message(Arg_&& arg, Args_... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* value);
-
-  private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(
-      const std::string& value);
-  std::string* _internal_mutable_message();
-
-  public:
-  // bool success = 2;
-  void clear_success() ;
-  bool success() const;
-  void set_success(bool value);
-
-  private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:orderbook.OrderResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      39, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const OrderResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr message_;
-    bool success_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_orderbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GetOrderBookRequest final : public ::google::protobuf::internal::ZeroFieldsBase
-/* @@protoc_insertion_point(class_definition:orderbook.GetOrderBookRequest) */ {
- public:
-  inline GetOrderBookRequest() : GetOrderBookRequest(nullptr) {}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetOrderBookRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetOrderBookRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetOrderBookRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline GetOrderBookRequest(const GetOrderBookRequest& from) : GetOrderBookRequest(nullptr, from) {}
-  inline GetOrderBookRequest(GetOrderBookRequest&& from) noexcept
-      : GetOrderBookRequest(nullptr, std::move(from)) {}
-  inline GetOrderBookRequest& operator=(const GetOrderBookRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GetOrderBookRequest& operator=(GetOrderBookRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const GetOrderBookRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const GetOrderBookRequest* internal_default_instance() {
-    return reinterpret_cast<const GetOrderBookRequest*>(
-        &_GetOrderBookRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(GetOrderBookRequest& a, GetOrderBookRequest& b) { a.Swap(&b); }
-  inline void Swap(GetOrderBookRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(GetOrderBookRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  GetOrderBookRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::internal::ZeroFieldsBase::DefaultConstruct<GetOrderBookRequest>(arena);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const GetOrderBookRequest& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const GetOrderBookRequest& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
-  }
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "orderbook.GetOrderBookRequest"; }
-
- protected:
-  explicit GetOrderBookRequest(::google::protobuf::Arena* arena);
-  GetOrderBookRequest(::google::protobuf::Arena* arena, const GetOrderBookRequest& from);
-  GetOrderBookRequest(::google::protobuf::Arena* arena, GetOrderBookRequest&& from) noexcept
-      : GetOrderBookRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  // @@protoc_insertion_point(class_scope:orderbook.GetOrderBookRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 0, 0,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GetOrderBookRequest& from_msg);
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  friend struct ::TableStruct_orderbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CancelOrderRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:orderbook.CancelOrderRequest) */ {
- public:
-  inline CancelOrderRequest() : CancelOrderRequest(nullptr) {}
-  ~CancelOrderRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CancelOrderRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CancelOrderRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CancelOrderRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CancelOrderRequest(const CancelOrderRequest& from) : CancelOrderRequest(nullptr, from) {}
-  inline CancelOrderRequest(CancelOrderRequest&& from) noexcept
-      : CancelOrderRequest(nullptr, std::move(from)) {}
-  inline CancelOrderRequest& operator=(const CancelOrderRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CancelOrderRequest& operator=(CancelOrderRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CancelOrderRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CancelOrderRequest* internal_default_instance() {
-    return reinterpret_cast<const CancelOrderRequest*>(
-        &_CancelOrderRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(CancelOrderRequest& a, CancelOrderRequest& b) { a.Swap(&b); }
-  inline void Swap(CancelOrderRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CancelOrderRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CancelOrderRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CancelOrderRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CancelOrderRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CancelOrderRequest& from) { CancelOrderRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CancelOrderRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "orderbook.CancelOrderRequest"; }
-
- protected:
-  explicit CancelOrderRequest(::google::protobuf::Arena* arena);
-  CancelOrderRequest(::google::protobuf::Arena* arena, const CancelOrderRequest& from);
-  CancelOrderRequest(::google::protobuf::Arena* arena, CancelOrderRequest&& from) noexcept
-      : CancelOrderRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOrderIdFieldNumber = 1,
-  };
-  // int32 order_id = 1;
-  void clear_order_id() ;
-  ::int32_t order_id() const;
-  void set_order_id(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_id() const;
-  void _internal_set_order_id(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:orderbook.CancelOrderRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CancelOrderRequest& from_msg);
-    ::int32_t order_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_orderbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class AddOrderRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:orderbook.AddOrderRequest) */ {
- public:
-  inline AddOrderRequest() : AddOrderRequest(nullptr) {}
-  ~AddOrderRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AddOrderRequest* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AddOrderRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AddOrderRequest(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline AddOrderRequest(const AddOrderRequest& from) : AddOrderRequest(nullptr, from) {}
-  inline AddOrderRequest(AddOrderRequest&& from) noexcept
-      : AddOrderRequest(nullptr, std::move(from)) {}
-  inline AddOrderRequest& operator=(const AddOrderRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AddOrderRequest& operator=(AddOrderRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AddOrderRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const AddOrderRequest* internal_default_instance() {
-    return reinterpret_cast<const AddOrderRequest*>(
-        &_AddOrderRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(AddOrderRequest& a, AddOrderRequest& b) { a.Swap(&b); }
-  inline void Swap(AddOrderRequest* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AddOrderRequest* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AddOrderRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AddOrderRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AddOrderRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AddOrderRequest& from) { AddOrderRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AddOrderRequest* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "orderbook.AddOrderRequest"; }
-
- protected:
-  explicit AddOrderRequest(::google::protobuf::Arena* arena);
-  AddOrderRequest(::google::protobuf::Arena* arena, const AddOrderRequest& from);
-  AddOrderRequest(::google::protobuf::Arena* arena, AddOrderRequest&& from) noexcept
-      : AddOrderRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kSideFieldNumber = 2,
-    kOrderTypeFieldNumber = 5,
-    kOrderIdFieldNumber = 1,
-    kQuantityFieldNumber = 4,
-    kPriceFieldNumber = 3,
-  };
-  // string side = 2;
-  void clear_side() ;
-  const std::string& side() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_side(Arg_&& arg, Args_... args);
-  std::string* mutable_side();
-  PROTOBUF_NODISCARD std::string* release_side();
-  void set_allocated_side(std::string* value);
-
-  private:
-  const std::string& _internal_side() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_side(
-      const std::string& value);
-  std::string* _internal_mutable_side();
-
-  public:
-  // string order_type = 5;
-  void clear_order_type() ;
-  const std::string& order_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_order_type(Arg_&& arg, Args_... args);
-  std::string* mutable_order_type();
-  PROTOBUF_NODISCARD std::string* release_order_type();
-  void set_allocated_order_type(std::string* value);
-
-  private:
-  const std::string& _internal_order_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_order_type(
-      const std::string& value);
-  std::string* _internal_mutable_order_type();
-
-  public:
-  // int32 order_id = 1;
-  void clear_order_id() ;
-  ::int32_t order_id() const;
-  void set_order_id(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_id() const;
-  void _internal_set_order_id(::int32_t value);
-
-  public:
-  // int32 quantity = 4;
-  void clear_quantity() ;
-  ::int32_t quantity() const;
-  void set_quantity(::int32_t value);
-
-  private:
-  ::int32_t _internal_quantity() const;
-  void _internal_set_quantity(::int32_t value);
-
-  public:
-  // double price = 3;
-  void clear_price() ;
-  double price() const;
-  void set_price(double value);
-
-  private:
-  double _internal_price() const;
-  void _internal_set_price(double value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:orderbook.AddOrderRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
-      48, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AddOrderRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr side_;
-    ::google::protobuf::internal::ArenaStringPtr order_type_;
-    ::int32_t order_id_;
-    ::int32_t quantity_;
-    double price_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_orderbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class OrderBookResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:orderbook.OrderBookResponse) */ {
- public:
-  inline OrderBookResponse() : OrderBookResponse(nullptr) {}
-  ~OrderBookResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(OrderBookResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderBookResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR OrderBookResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline OrderBookResponse(const OrderBookResponse& from) : OrderBookResponse(nullptr, from) {}
-  inline OrderBookResponse(OrderBookResponse&& from) noexcept
-      : OrderBookResponse(nullptr, std::move(from)) {}
-  inline OrderBookResponse& operator=(const OrderBookResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline OrderBookResponse& operator=(OrderBookResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const OrderBookResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const OrderBookResponse* internal_default_instance() {
-    return reinterpret_cast<const OrderBookResponse*>(
-        &_OrderBookResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(OrderBookResponse& a, OrderBookResponse& b) { a.Swap(&b); }
-  inline void Swap(OrderBookResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(OrderBookResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  OrderBookResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<OrderBookResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OrderBookResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const OrderBookResponse& from) { OrderBookResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(OrderBookResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "orderbook.OrderBookResponse"; }
-
- protected:
-  explicit OrderBookResponse(::google::protobuf::Arena* arena);
-  OrderBookResponse(::google::protobuf::Arena* arena, const OrderBookResponse& from);
-  OrderBookResponse(::google::protobuf::Arena* arena, OrderBookResponse&& from) noexcept
-      : OrderBookResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kBidsFieldNumber = 1,
-    kAsksFieldNumber = 2,
-  };
-  // repeated .orderbook.PriceLevel bids = 1;
-  int bids_size() const;
-  private:
-  int _internal_bids_size() const;
-
-  public:
-  void clear_bids() ;
-  ::orderbook::PriceLevel* mutable_bids(int index);
-  ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>* mutable_bids();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>& _internal_bids() const;
-  ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>* _internal_mutable_bids();
-  public:
-  const ::orderbook::PriceLevel& bids(int index) const;
-  ::orderbook::PriceLevel* add_bids();
-  const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>& bids() const;
-  // repeated .orderbook.PriceLevel asks = 2;
-  int asks_size() const;
-  private:
-  int _internal_asks_size() const;
-
-  public:
-  void clear_asks() ;
-  ::orderbook::PriceLevel* mutable_asks(int index);
-  ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>* mutable_asks();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>& _internal_asks() const;
-  ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>* _internal_mutable_asks();
-  public:
-  const ::orderbook::PriceLevel& asks(int index) const;
-  ::orderbook::PriceLevel* add_asks();
-  const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>& asks() const;
-  // @@protoc_insertion_point(class_scope:orderbook.OrderBookResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 2,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const OrderBookResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::orderbook::PriceLevel > bids_;
-    ::google::protobuf::RepeatedPtrField< ::orderbook::PriceLevel > asks_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_orderbook_2eproto;
-};
-
-// ===================================================================
-
-
-
-
-// ===================================================================
-
-
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// AddOrderRequest
-
-// int32 order_id = 1;
-inline void AddOrderRequest::clear_order_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = 0;
-}
-inline ::int32_t AddOrderRequest::order_id() const {
-  // @@protoc_insertion_point(field_get:orderbook.AddOrderRequest.order_id)
-  return _internal_order_id();
-}
-inline void AddOrderRequest::set_order_id(::int32_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:orderbook.AddOrderRequest.order_id)
-}
-inline ::int32_t AddOrderRequest::_internal_order_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_id_;
-}
-inline void AddOrderRequest::_internal_set_order_id(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = value;
-}
-
-// string side = 2;
-inline void AddOrderRequest::clear_side() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.side_.ClearToEmpty();
-}
-inline const std::string& AddOrderRequest::side() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:orderbook.AddOrderRequest.side)
-  return _internal_side();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AddOrderRequest::set_side(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.side_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:orderbook.AddOrderRequest.side)
-}
-inline std::string* AddOrderRequest::mutable_side() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_side();
-  // @@protoc_insertion_point(field_mutable:orderbook.AddOrderRequest.side)
-  return _s;
-}
-inline const std::string& AddOrderRequest::_internal_side() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.side_.Get();
-}
-inline void AddOrderRequest::_internal_set_side(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.side_.Set(value, GetArena());
-}
-inline std::string* AddOrderRequest::_internal_mutable_side() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.side_.Mutable( GetArena());
-}
-inline std::string* AddOrderRequest::release_side() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:orderbook.AddOrderRequest.side)
-  return _impl_.side_.Release();
-}
-inline void AddOrderRequest::set_allocated_side(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.side_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.side_.IsDefault()) {
-    _impl_.side_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:orderbook.AddOrderRequest.side)
-}
-
-// double price = 3;
-inline void AddOrderRequest::clear_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = 0;
-}
-inline double AddOrderRequest::price() const {
-  // @@protoc_insertion_point(field_get:orderbook.AddOrderRequest.price)
-  return _internal_price();
-}
-inline void AddOrderRequest::set_price(double value) {
-  _internal_set_price(value);
-  // @@protoc_insertion_point(field_set:orderbook.AddOrderRequest.price)
-}
-inline double AddOrderRequest::_internal_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.price_;
-}
-inline void AddOrderRequest::_internal_set_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = value;
-}
-
-// int32 quantity = 4;
-inline void AddOrderRequest::clear_quantity() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.quantity_ = 0;
-}
-inline ::int32_t AddOrderRequest::quantity() const {
-  // @@protoc_insertion_point(field_get:orderbook.AddOrderRequest.quantity)
-  return _internal_quantity();
-}
-inline void AddOrderRequest::set_quantity(::int32_t value) {
-  _internal_set_quantity(value);
-  // @@protoc_insertion_point(field_set:orderbook.AddOrderRequest.quantity)
-}
-inline ::int32_t AddOrderRequest::_internal_quantity() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.quantity_;
-}
-inline void AddOrderRequest::_internal_set_quantity(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.quantity_ = value;
-}
-
-// string order_type = 5;
-inline void AddOrderRequest::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.ClearToEmpty();
-}
-inline const std::string& AddOrderRequest::order_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:orderbook.AddOrderRequest.order_type)
-  return _internal_order_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AddOrderRequest::set_order_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:orderbook.AddOrderRequest.order_type)
-}
-inline std::string* AddOrderRequest::mutable_order_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_order_type();
-  // @@protoc_insertion_point(field_mutable:orderbook.AddOrderRequest.order_type)
-  return _s;
-}
-inline const std::string& AddOrderRequest::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_.Get();
-}
-inline void AddOrderRequest::_internal_set_order_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(value, GetArena());
-}
-inline std::string* AddOrderRequest::_internal_mutable_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.order_type_.Mutable( GetArena());
-}
-inline std::string* AddOrderRequest::release_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:orderbook.AddOrderRequest.order_type)
-  return _impl_.order_type_.Release();
-}
-inline void AddOrderRequest::set_allocated_order_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.order_type_.IsDefault()) {
-    _impl_.order_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:orderbook.AddOrderRequest.order_type)
-}
-
-// -------------------------------------------------------------------
-
-// CancelOrderRequest
-
-// int32 order_id = 1;
-inline void CancelOrderRequest::clear_order_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = 0;
-}
-inline ::int32_t CancelOrderRequest::order_id() const {
-  // @@protoc_insertion_point(field_get:orderbook.CancelOrderRequest.order_id)
-  return _internal_order_id();
-}
-inline void CancelOrderRequest::set_order_id(::int32_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:orderbook.CancelOrderRequest.order_id)
-}
-inline ::int32_t CancelOrderRequest::_internal_order_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_id_;
-}
-inline void CancelOrderRequest::_internal_set_order_id(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// GetOrderBookRequest
-
-// -------------------------------------------------------------------
-
-// OrderResponse
-
-// string message = 1;
-inline void OrderResponse::clear_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.ClearToEmpty();
-}
-inline const std::string& OrderResponse::message() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:orderbook.OrderResponse.message)
-  return _internal_message();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void OrderResponse::set_message(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:orderbook.OrderResponse.message)
-}
-inline std::string* OrderResponse::mutable_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:orderbook.OrderResponse.message)
-  return _s;
-}
-inline const std::string& OrderResponse::_internal_message() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.message_.Get();
-}
-inline void OrderResponse::_internal_set_message(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.Set(value, GetArena());
-}
-inline std::string* OrderResponse::_internal_mutable_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.message_.Mutable( GetArena());
-}
-inline std::string* OrderResponse::release_message() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:orderbook.OrderResponse.message)
-  return _impl_.message_.Release();
-}
-inline void OrderResponse::set_allocated_message(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.message_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:orderbook.OrderResponse.message)
-}
-
-// bool success = 2;
-inline void OrderResponse::clear_success() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.success_ = false;
-}
-inline bool OrderResponse::success() const {
-  // @@protoc_insertion_point(field_get:orderbook.OrderResponse.success)
-  return _internal_success();
-}
-inline void OrderResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:orderbook.OrderResponse.success)
-}
-inline bool OrderResponse::_internal_success() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.success_;
-}
-inline void OrderResponse::_internal_set_success(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.success_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// OrderBookResponse
-
-// repeated .orderbook.PriceLevel bids = 1;
-inline int OrderBookResponse::_internal_bids_size() const {
-  return _internal_bids().size();
-}
-inline int OrderBookResponse::bids_size() const {
-  return _internal_bids_size();
-}
-inline void OrderBookResponse::clear_bids() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bids_.Clear();
-}
-inline ::orderbook::PriceLevel* OrderBookResponse::mutable_bids(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:orderbook.OrderBookResponse.bids)
-  return _internal_mutable_bids()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>* OrderBookResponse::mutable_bids()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:orderbook.OrderBookResponse.bids)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_bids();
-}
-inline const ::orderbook::PriceLevel& OrderBookResponse::bids(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:orderbook.OrderBookResponse.bids)
-  return _internal_bids().Get(index);
-}
-inline ::orderbook::PriceLevel* OrderBookResponse::add_bids() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::orderbook::PriceLevel* _add = _internal_mutable_bids()->Add();
-  // @@protoc_insertion_point(field_add:orderbook.OrderBookResponse.bids)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>& OrderBookResponse::bids() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:orderbook.OrderBookResponse.bids)
-  return _internal_bids();
-}
-inline const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>&
-OrderBookResponse::_internal_bids() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bids_;
-}
-inline ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>*
-OrderBookResponse::_internal_mutable_bids() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.bids_;
-}
-
-// repeated .orderbook.PriceLevel asks = 2;
-inline int OrderBookResponse::_internal_asks_size() const {
-  return _internal_asks().size();
-}
-inline int OrderBookResponse::asks_size() const {
-  return _internal_asks_size();
-}
-inline void OrderBookResponse::clear_asks() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.asks_.Clear();
-}
-inline ::orderbook::PriceLevel* OrderBookResponse::mutable_asks(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:orderbook.OrderBookResponse.asks)
-  return _internal_mutable_asks()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>* OrderBookResponse::mutable_asks()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:orderbook.OrderBookResponse.asks)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_asks();
-}
-inline const ::orderbook::PriceLevel& OrderBookResponse::asks(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:orderbook.OrderBookResponse.asks)
-  return _internal_asks().Get(index);
-}
-inline ::orderbook::PriceLevel* OrderBookResponse::add_asks() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::orderbook::PriceLevel* _add = _internal_mutable_asks()->Add();
-  // @@protoc_insertion_point(field_add:orderbook.OrderBookResponse.asks)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>& OrderBookResponse::asks() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:orderbook.OrderBookResponse.asks)
-  return _internal_asks();
-}
-inline const ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>&
-OrderBookResponse::_internal_asks() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.asks_;
-}
-inline ::google::protobuf::RepeatedPtrField<::orderbook::PriceLevel>*
-OrderBookResponse::_internal_mutable_asks() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.asks_;
-}
-
-// -------------------------------------------------------------------
-
-// PriceLevel
-
-// double price = 1;
-inline void PriceLevel::clear_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = 0;
-}
-inline double PriceLevel::price() const {
-  // @@protoc_insertion_point(field_get:orderbook.PriceLevel.price)
-  return _internal_price();
-}
-inline void PriceLevel::set_price(double value) {
-  _internal_set_price(value);
-  // @@protoc_insertion_point(field_set:orderbook.PriceLevel.price)
-}
-inline double PriceLevel::_internal_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.price_;
-}
-inline void PriceLevel::_internal_set_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = value;
-}
-
-// int32 quantity = 2;
-inline void PriceLevel::clear_quantity() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.quantity_ = 0;
-}
-inline ::int32_t PriceLevel::quantity() const {
-  // @@protoc_insertion_point(field_get:orderbook.PriceLevel.quantity)
-  return _internal_quantity();
-}
-inline void PriceLevel::set_quantity(::int32_t value) {
-  _internal_set_quantity(value);
-  // @@protoc_insertion_point(field_set:orderbook.PriceLevel.quantity)
-}
-inline ::int32_t PriceLevel::_internal_quantity() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.quantity_;
-}
-inline void PriceLevel::_internal_set_quantity(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.quantity_ = value;
-}
-
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif  // __GNUC__
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace orderbook
-
-
-// @@protoc_insertion_point(global_scope)
-
-#include "google/protobuf/port_undef.inc"
-
-#endif  // orderbook_2eproto_2epb_2eh
@@ -0,0 +1,150 @@
+#include "huge_page_arena.hpp"
+#include "thread_affinity.hpp"
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+    std::size_t RoundUp(std::size_t value, std::size_t multiple)
+    {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    // Never destroyed: a book in a static built before the first call would otherwise outlive it and give its
+    // memory back to a destroyed arena at exit
+    HugePageArena*& DefaultArena()
+    {
+        static HugePageArena* arena = new HugePageArena();
+        return arena;
+    }
+}
+
+HugePageArena::HugePageArena(std::size_t bytes, bool prefault)
+{
+#if defined(__linux__)
+    capacity_ = RoundUp(std::max<std::size_t>(bytes, 1), HugePageSize);
+
+    // Explicit huge pages come aligned. They need pages reserved through vm.nr_hugepages
+    void* memory = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory != MAP_FAILED) {
+        mappingBytes_ = capacity_;
+        backing_ = Backing::ExplicitHugePages;
+    }
+    else {
+        // Transparent huge pages only back whole aligned 2MB ranges, so map one extra page to align within
+        mappingBytes_ = capacity_ + HugePageSize;
+        memory = mmap(nullptr, mappingBytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            mappingBytes_ = capacity_ = 0;
+            return;
+        }
+    }
+
+    mapping_ = static_cast<std::byte*>(memory);
+    begin_ = reinterpret_cast<std::byte*>(RoundUp(reinterpret_cast<std::uintptr_t>(mapping_), HugePageSize));
+    if (backing_ != Backing::ExplicitHugePages)
+        backing_ = madvise(begin_, capacity_, MADV_HUGEPAGE) == 0 ? Backing::TransparentHugePages : Backing::NormalPages;
+
+    if (prefault) {
+        // One write per small page faults in whatever page size backs it
+        constexpr std::size_t PageSize = 4096;
+        for (std::size_t offset = 0; offset < capacity_; offset += PageSize)
+            static_cast<volatile std::byte*>(begin_)[offset] = std::byte{0};
+    }
+#else
+    (void)bytes;
+    (void)prefault;
+#endif
+}
+
+HugePageArena::~HugePageArena()
+{
+#if defined(__linux__)
+    if (mapping_)
+        munmap(mapping_, mappingBytes_);
+#endif
+}
+
+void HugePageArena::Lock()
+{
+    while (lock_.test_and_set(std::memory_order_acquire))
+        CpuRelax();
+}
+
+void* HugePageArena::Allocate(std::size_t bytes)
+{
+    const auto size = RoundUp(std::max<std::size_t>(bytes, 1), Alignment);
+    const auto sizeClass = size / Alignment;
+
+    Lock();
+    void* block = nullptr;
+    if (sizeClass <= SmallSizes && smallFree_[sizeClass]) {
+        block = smallFree_[sizeClass];
+        smallFree_[sizeClass] = *static_cast<void**>(block);
+    }
+    else if (sizeClass > SmallSizes) {
+        if (auto free = largeFree_.find(size); free != largeFree_.end() && !free->second.empty()) {
+            block = free->second.back();
+            free->second.pop_back();
+        }
+    }
+    if (!block && used_ + size <= capacity_) {
+        block = begin_ + used_;
+        used_ += size;
+    }
+    Unlock();
+
+    return block ? block : ::operator new(bytes);
+}
+
+void HugePageArena::Deallocate(void* pointer, std::size_t bytes)
+{
+    if (!Owns(pointer)) {
+        ::operator delete(pointer);
+        return;
+    }
+
+    const auto size = RoundUp(std::max<std::size_t>(bytes, 1), Alignment);
+    const auto sizeClass = size / Alignment;
+
+    Lock();
+    if (sizeClass <= SmallSizes) {
+        *static_cast<void**>(pointer) = smallFree_[sizeClass];
+        smallFree_[sizeClass] = pointer;
+    }
+    else {
+        largeFree_[size].push_back(pointer);
+    }
+    Unlock();
+}
+
+HugePageArena& HugePageArena::Default()
+{
+    return *DefaultArena();
+}
+
+HugePageArena& HugePageArena::ConfigureDefault(std::size_t bytes, bool prefault)
+{
+    auto& arena = DefaultArena();
+    if (arena->Capacity() > 0)
+        throw std::logic_error("The default huge page arena is already configured");
+
+    // The empty arena it replaces is kept, references to it stay valid and it owns no block
+    arena = new HugePageArena(bytes, prefault);
+    return *arena;
+}
+
+const char* ToString(HugePageArena::Backing backing)
+{
+    switch (backing) {
+        case HugePageArena::Backing::None: return "none";
+        case HugePageArena::Backing::ExplicitHugePages: return "explicit huge pages";
+        case HugePageArena::Backing::TransparentHugePages: return "transparent huge pages";
+        case HugePageArena::Backing::NormalPages: return "normal pages";
+    }
+    return "unknown";
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Memory for the node based containers of a book, taken from one region mapped up front.
+ * The region is backed by explicit 2MB huge pages (MAP_HUGETLB) when the system has them reserved,
+ * else by transparent huge pages (madvise MADV_HUGEPAGE), else by normal pages. Millions of list,
+ * tree and hash nodes then sit in a few hundred TLB entries instead of hundreds of thousands.
+ * The region is prefaulted when it is mapped, so the first trading minutes do not take page faults.
+ *
+ * Blocks come from a bump pointer and are recycled through per size free lists. Once the region is
+ * used up, allocations fall back to operator new, and those blocks go back to operator delete.
+ */
+class HugePageArena
+{
+    public:
+        enum class Backing {
+            None,                 // Nothing mapped, everything goes to operator new
+            ExplicitHugePages,
+            TransparentHugePages,
+            NormalPages
+        };
+
+        static constexpr std::size_t HugePageSize = std::size_t{2} << 20;
+        static constexpr std::size_t Alignment = 16;
+
+    private:
+        static constexpr std::size_t SmallSizes = 32; // Free lists of blocks up to SmallSizes * Alignment bytes
+
+        std::byte* mapping_ {};   // What mmap returned
+        std::size_t mappingBytes_ {};
+        std::byte* begin_ {};     // The huge page aligned region
+        std::size_t capacity_ {};
+        std::size_t used_ {};
+        Backing backing_ {Backing::None};
+
+        // Each free block holds the next one
+        std::array<void*, SmallSizes + 1> smallFree_ {};
+        std::unordered_map<std::size_t, std::vector<void*>> largeFree_;
+        // Allocation is cheap enough that a spin lock beats a mutex, and contention is rare
+        std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+
+        void Lock();
+        void Unlock() { lock_.clear(std::memory_order_release); }
+        bool Owns(const void* pointer) const
+        {
+            return pointer >= begin_ && pointer < begin_ + capacity_;
+        }
+
+    public:
+        HugePageArena() = default;
+        // Map at least bytes, rounded up to whole huge pages. Prefault touches every page of the region
+        HugePageArena(std::size_t bytes, bool prefault);
+        HugePageArena(const HugePageArena&) = delete;
+        HugePageArena& operator=(const HugePageArena&) = delete;
+        ~HugePageArena();
+
+        void* Allocate(std::size_t bytes);
+        void Deallocate(void* pointer, std::size_t bytes);
+
+        Backing GetBacking() const { return backing_; }
+        std::size_t Capacity() const { return capacity_; }
+        std::size_t Used() const { return used_; }
+
+        // The arena HugePageAllocator draws from. Empty until ConfigureDefault is called, and never destroyed so
+        // books in statics can free into it at exit
+        static HugePageArena& Default();
+        // Map the default arena. Call once at startup, before the books using it fill up: memory handed out
+        // before came from operator new and is still given back correctly
+        static HugePageArena& ConfigureDefault(std::size_t bytes, bool prefault = true);
+};
+
+const char* ToString(HugePageArena::Backing backing);
+
+// Allocator over HugePageArena::Default(), for the Allocator slot of a book's traits
+template <typename T>
+struct HugePageAllocator {
+    static_assert(alignof(T) <= HugePageArena::Alignment, "HugePageArena blocks are only 16 byte aligned");
+
+    using value_type = T;
+
+    HugePageAllocator() = default;
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) {}
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(HugePageArena::Default().Allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t count)
+    {
+        HugePageArena::Default().Deallocate(pointer, count * sizeof(T));
+    }
+
+    friend bool operator==(const HugePageAllocator&, const HugePageAllocator&) { return true; }
+    friend bool operator!=(const HugePageAllocator&, const HugePageAllocator&) { return false; }
+};
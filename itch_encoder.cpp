@@ -0,0 +1,144 @@
+#include "itch_encoder.hpp"
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    std::uint64_t NanosecondsSinceMidnight()
+    {
+        constexpr std::uint64_t NanosecondsPerDay = 86'400'000'000'000ULL;
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+        return static_cast<std::uint64_t>(now.count()) % NanosecondsPerDay;
+    }
+
+    std::uint8_t SideCode(Side side)
+    {
+        return side == Side::Buy ? 'B' : 'S';
+    }
+}
+
+ItchEncoder::ItchEncoder(std::uint16_t locate, const std::string& stock, std::size_t bufferSize, Sink sink, std::uint32_t priceScale)
+: locate_{locate}
+, priceScale_{priceScale}
+, sink_{std::move(sink)}
+, capacity_{bufferSize}
+{
+    if (bufferSize < Itch::MaxFrameSize)
+        throw std::invalid_argument("Market data buffer of " + std::to_string(bufferSize) + " bytes cannot hold a message");
+    if (stock.size() > sizeof(stock_))
+        throw std::invalid_argument("Symbol " + stock + " is longer than 8 characters");
+
+    // Symbols are left aligned and padded with spaces
+    std::memset(stock_, ' ', sizeof(stock_));
+    std::memcpy(stock_, stock.data(), stock.size());
+    buffer_ = std::make_unique<std::uint8_t[]>(capacity_);
+    StockDirectory();
+}
+
+ItchEncoder::~ItchEncoder()
+{
+    Flush();
+}
+
+std::uint8_t* ItchEncoder::Begin(char type, std::size_t size)
+{
+    if (size_ + 2 + size > capacity_)
+        Flush();
+
+    auto* frame = buffer_.get() + size_;
+    size_ += 2 + size;
+    ++count_;
+
+    Itch::WriteU16(frame, static_cast<std::uint16_t>(size));
+    auto* message = frame + 2;
+    message[0] = static_cast<std::uint8_t>(type);
+    Itch::WriteU16(message + 1, locate_);
+    Itch::WriteU16(message + 3, 0);
+    Itch::WriteU48(message + 5, NanosecondsSinceMidnight());
+    return message;
+}
+
+void ItchEncoder::StockDirectory()
+{
+    auto* message = Begin('R', Itch::StockDirectorySize);
+    std::memcpy(message + 11, stock_, sizeof(stock_));
+    message[19] = 'Q';                  // Market category: NASDAQ Global Select
+    message[20] = 'N';                  // Financial status: normal
+    Itch::WriteU32(message + 21, 1);    // Round lot size, every quantity is a round lot
+    message[25] = 'N';                  // Round lots only
+    message[26] = 'C';                  // Issue classification: common stock
+    message[27] = 'Z';                  // Issue sub-type: not applicable
+    message[28] = ' ';
+    message[29] = 'P';                  // Authenticity: production
+    message[30] = ' ';                  // Short sale threshold, IPO flag, LULD tier and ETP flag: not available
+    message[31] = ' ';
+    message[32] = ' ';
+    message[33] = ' ';
+    Itch::WriteU32(message + 34, 0);    // ETP leverage factor
+    message[38] = 'N';                  // Inverse indicator
+}
+
+std::uint32_t ItchEncoder::ScalePrice(std::int64_t price) const
+{
+    // Checked before scaling, the product itself could overflow
+    if (price < 0 || static_cast<std::uint64_t>(price) > std::numeric_limits<std::uint32_t>::max() / priceScale_)
+        throw std::out_of_range("Price " + std::to_string(price) + " does not fit an ITCH price at scale " + std::to_string(priceScale_));
+    return static_cast<std::uint32_t>(price * priceScale_);
+}
+
+void ItchEncoder::AddOrder(OrderId orderId, Side side, std::uint64_t quantity, std::int64_t price)
+{
+    const auto scaled = ScalePrice(price);
+    auto* message = Begin('A', Itch::AddOrderSize);
+    Itch::WriteU64(message + 11, orderId);
+    message[19] = SideCode(side);
+    Itch::WriteU32(message + 20, static_cast<std::uint32_t>(quantity));
+    std::memcpy(message + 24, stock_, sizeof(stock_));
+    Itch::WriteU32(message + 32, scaled);
+}
+
+void ItchEncoder::OrderExecuted(OrderId orderId, std::uint64_t quantity)
+{
+    auto* message = Begin('E', Itch::OrderExecutedSize);
+    Itch::WriteU64(message + 11, orderId);
+    Itch::WriteU32(message + 19, static_cast<std::uint32_t>(quantity));
+    Itch::WriteU64(message + 23, matchNumber_);
+}
+
+void ItchEncoder::OrderCancel(OrderId orderId, std::uint64_t quantity)
+{
+    auto* message = Begin('X', Itch::OrderCancelSize);
+    Itch::WriteU64(message + 11, orderId);
+    Itch::WriteU32(message + 19, static_cast<std::uint32_t>(quantity));
+}
+
+void ItchEncoder::OrderDelete(OrderId orderId)
+{
+    auto* message = Begin('D', Itch::OrderDeleteSize);
+    Itch::WriteU64(message + 11, orderId);
+}
+
+void ItchEncoder::Trade(OrderId restingOrderId, Side restingSide, std::uint64_t quantity, std::int64_t price)
+{
+    const auto scaled = ScalePrice(price);
+    auto* message = Begin('P', Itch::TradeSize);
+    Itch::WriteU64(message + 11, restingOrderId);
+    message[19] = SideCode(restingSide);
+    Itch::WriteU32(message + 20, static_cast<std::uint32_t>(quantity));
+    std::memcpy(message + 24, stock_, sizeof(stock_));
+    Itch::WriteU32(message + 32, scaled);
+    Itch::WriteU64(message + 36, ++matchNumber_);
+}
+
+void ItchEncoder::Flush()
+{
+    if (count_ == 0)
+        return;
+
+    if (sink_)
+        sink_(firstSequence_, count_, buffer_.get(), size_);
+    firstSequence_ += count_;
+    count_ = 0;
+    size_ = 0;
+}
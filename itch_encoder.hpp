@@ -0,0 +1,82 @@
+#pragma once
+#include "itch_format.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+/*
+ * Market data out of the engine as NASDAQ TotalView-ITCH 5.0 messages, so the tools that read exchange
+ * feeds read ours too. The book reports its events (see BasicOrderBook::SetMarketDataEncoder) and the encoder
+ * writes them into one buffer allocated up front, so encoding a message never allocates.
+ *
+ *   'R' stock directory, once when the encoder is made
+ *   'A' add order        a limit order (or a new iceberg tranche) rests in the book
+ *   'E' order executed   a resting order traded, with the match number of its trade
+ *   'X' order cancel     part of a resting order went away without trading (amend, self trade decrement)
+ *   'D' order delete     a resting order was cancelled
+ *   'P' trade            every trade, with the resting order's id and side and the execution price
+ *
+ * An 'E' or 'X' that leaves an order with nothing displayed removes it. An incoming order is added once it has
+ * matched, with what is left of it, so only its counterparties report executions and the book never crosses
+ * outside an auction. Pegged and stop orders are not displayed, they only show up in 'P'. Unlike NASDAQ, 'P' reports every trade and not only those
+ * of hidden orders: a book is rebuilt from A/E/X/D, prints and volume come from P.
+ *
+ * As in the ITCH files NASDAQ publishes, every message is preceded by its length (see itch_format.hpp).
+ * Messages are numbered 1, 2, 3... in the order they were encoded; the buffer is handed to the sink with the
+ * sequence number of its first message, as a MoldUDP64 packet carries them. Prices are written with 4 implied
+ * decimals and quantities as u32, the ITCH field widths.
+ */
+
+class ItchEncoder
+{
+    public:
+        // Takes the messages encoded since the last flush: count messages, numbered from firstSequence,
+        // in size bytes of length prefixed frames. data is only valid during the call
+        using Sink = std::function<void(std::uint64_t firstSequence, std::size_t count, const std::uint8_t* data, std::size_t size)>;
+
+        // Messages of one instrument, stock locate locate and symbol stock (at most 8 characters).
+        // A price of 1 tick is priceScale ten-thousandths, 100 for prices in cents.
+        // std::invalid_argument if bufferSize cannot hold a message or the symbol is too long
+        ItchEncoder(std::uint16_t locate, const std::string& stock, std::size_t bufferSize, Sink sink, std::uint32_t priceScale = 100);
+        ItchEncoder(const ItchEncoder&) = delete;
+        ItchEncoder& operator=(const ItchEncoder&) = delete;
+        // Flushes what is left
+        ~ItchEncoder();
+
+        // AddOrder and Trade throw std::out_of_range for a price that is negative or past the u32 price field once
+        // scaled (429496.7295), and encode nothing. The book has applied the event by then, so pick a priceScale
+        // that fits the prices it trades at
+        void AddOrder(OrderId orderId, Side side, std::uint64_t quantity, std::int64_t price);
+        void OrderExecuted(OrderId orderId, std::uint64_t quantity);
+        void OrderCancel(OrderId orderId, std::uint64_t quantity);
+        void OrderDelete(OrderId orderId);
+        // Starts a new match number, which the executions reported after it until the next trade carry
+        void Trade(OrderId restingOrderId, Side restingSide, std::uint64_t quantity, std::int64_t price);
+
+        // Hand the buffered messages to the sink, if there are any
+        void Flush();
+
+        // Sequence number the next message gets
+        std::uint64_t NextSequence() const { return firstSequence_ + count_; }
+        std::uint64_t MatchNumber() const { return matchNumber_; }
+
+    private:
+        std::uint16_t locate_;
+        char stock_[8];
+        std::uint32_t priceScale_;
+        Sink sink_;
+        std::unique_ptr<std::uint8_t[]> buffer_;
+        std::size_t capacity_;
+        std::size_t size_ {0};
+        std::size_t count_ {0};
+        std::uint64_t firstSequence_ {1};
+        std::uint64_t matchNumber_ {0};
+
+        // Room for a message of size bytes after its length, with the common header written:
+        // type, stock locate, tracking number (always 0) and timestamp
+        std::uint8_t* Begin(char type, std::size_t size);
+        void StockDirectory();
+        std::uint32_t ScalePrice(std::int64_t price) const;
+};
@@ -0,0 +1,138 @@
+#pragma once
+#include "types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/*
+ * NASDAQ TotalView-ITCH 5.0 as the engine writes (itch_encoder.hpp) and reads (feed_handler.hpp) it.
+ * A stream is a sequence of frames: the message length as a big-endian u16, then the message. Every message
+ * starts with its type, the stock locate (u16), a tracking number (u16) and a timestamp in nanoseconds since
+ * midnight (u48). All integers are big-endian, prices have 4 implied decimals.
+ * The views read their fields straight out of the frame, a stream is decoded without copying it.
+ */
+
+namespace Itch {
+    // Message sizes without the length prefix, by type
+    constexpr std::size_t SystemEventSize = 12;             // 'S'
+    constexpr std::size_t StockDirectorySize = 39;          // 'R'
+    constexpr std::size_t AddOrderSize = 36;                // 'A'
+    constexpr std::size_t AddOrderWithMpidSize = 40;        // 'F', an add with the attribution of the firm
+    constexpr std::size_t OrderExecutedSize = 31;           // 'E'
+    constexpr std::size_t OrderExecutedWithPriceSize = 36;  // 'C', an execution away from the order's price
+    constexpr std::size_t OrderCancelSize = 23;             // 'X'
+    constexpr std::size_t OrderDeleteSize = 19;             // 'D'
+    constexpr std::size_t OrderReplaceSize = 35;            // 'U'
+    constexpr std::size_t TradeSize = 44;                   // 'P'
+    // Longest message the encoder writes plus its length prefix
+    constexpr std::size_t MaxFrameSize = 2 + TradeSize;
+
+    inline void WriteU16(std::uint8_t* out, std::uint16_t value) { out[0] = value >> 8; out[1] = static_cast<std::uint8_t>(value); }
+    inline void WriteU32(std::uint8_t* out, std::uint32_t value) { WriteU16(out, value >> 16); WriteU16(out + 2, static_cast<std::uint16_t>(value)); }
+    inline void WriteU48(std::uint8_t* out, std::uint64_t value) { WriteU16(out, static_cast<std::uint16_t>(value >> 32)); WriteU32(out + 2, static_cast<std::uint32_t>(value)); }
+    inline void WriteU64(std::uint8_t* out, std::uint64_t value) { WriteU32(out, value >> 32); WriteU32(out + 4, static_cast<std::uint32_t>(value)); }
+
+    inline std::uint16_t ReadU16(const std::uint8_t* in) { return static_cast<std::uint16_t>(in[0] << 8 | in[1]); }
+    inline std::uint32_t ReadU32(const std::uint8_t* in) { return std::uint32_t{ReadU16(in)} << 16 | ReadU16(in + 2); }
+    inline std::uint64_t ReadU48(const std::uint8_t* in) { return std::uint64_t{ReadU16(in)} << 32 | ReadU32(in + 2); }
+    inline std::uint64_t ReadU64(const std::uint8_t* in) { return std::uint64_t{ReadU32(in)} << 32 | ReadU32(in + 4); }
+
+    // Symbols are 8 characters padded with spaces
+    inline std::string_view ReadStock(const std::uint8_t* in)
+    {
+        std::string_view stock{reinterpret_cast<const char*>(in), 8};
+        return stock.substr(0, stock.find_last_not_of(' ') + 1);
+    }
+
+    // One message of a stream, with the header fields every type shares
+    class MessageView
+    {
+        public:
+            MessageView(const std::uint8_t* data, std::size_t size)
+            : data_{data}, size_{size}
+            {}
+
+            char Type() const { return static_cast<char>(data_[0]); }
+            std::size_t Size() const { return size_; }
+            std::uint16_t Locate() const { return ReadU16(data_ + 1); }
+            std::uint64_t Timestamp() const { return ReadU48(data_ + 5); }
+            // The frame is long enough for the fields of its type, the typed views below assume it
+            bool HasSize(std::size_t size) const { return size_ >= size; }
+
+        protected:
+            const std::uint8_t* data_;
+            std::size_t size_;
+    };
+
+    // 'R'
+    struct StockDirectoryView : MessageView {
+        explicit StockDirectoryView(const MessageView& message) : MessageView{message} {}
+        std::string_view Stock() const { return ReadStock(data_ + 11); }
+    };
+
+    // 'A' and 'F'
+    struct AddOrderView : MessageView {
+        explicit AddOrderView(const MessageView& message) : MessageView{message} {}
+        OrderId GetOrderId() const { return ReadU64(data_ + 11); }
+        Side GetSide() const { return data_[19] == 'B' ? Side::Buy : Side::Sell; }
+        std::uint32_t Shares() const { return ReadU32(data_ + 20); }
+        std::string_view Stock() const { return ReadStock(data_ + 24); }
+        std::uint32_t Price() const { return ReadU32(data_ + 32); }
+    };
+
+    // 'E' and 'C'
+    struct OrderExecutedView : MessageView {
+        explicit OrderExecutedView(const MessageView& message) : MessageView{message} {}
+        OrderId GetOrderId() const { return ReadU64(data_ + 11); }
+        std::uint32_t Shares() const { return ReadU32(data_ + 19); }
+        std::uint64_t MatchNumber() const { return ReadU64(data_ + 23); }
+    };
+
+    // 'X'
+    struct OrderCancelView : MessageView {
+        explicit OrderCancelView(const MessageView& message) : MessageView{message} {}
+        OrderId GetOrderId() const { return ReadU64(data_ + 11); }
+        std::uint32_t Shares() const { return ReadU32(data_ + 19); }
+    };
+
+    // 'D'
+    struct OrderDeleteView : MessageView {
+        explicit OrderDeleteView(const MessageView& message) : MessageView{message} {}
+        OrderId GetOrderId() const { return ReadU64(data_ + 11); }
+    };
+
+    // 'U': the original order goes away and the new one, on the same side, joins the back of its level
+    struct OrderReplaceView : MessageView {
+        explicit OrderReplaceView(const MessageView& message) : MessageView{message} {}
+        OrderId GetOriginalOrderId() const { return ReadU64(data_ + 11); }
+        OrderId GetNewOrderId() const { return ReadU64(data_ + 19); }
+        std::uint32_t Shares() const { return ReadU32(data_ + 27); }
+        std::uint32_t Price() const { return ReadU32(data_ + 31); }
+    };
+
+    // 'P'
+    struct TradeView : MessageView {
+        explicit TradeView(const MessageView& message) : MessageView{message} {}
+        OrderId GetOrderId() const { return ReadU64(data_ + 11); }
+        Side GetSide() const { return data_[19] == 'B' ? Side::Buy : Side::Sell; }
+        std::uint32_t Shares() const { return ReadU32(data_ + 20); }
+        std::uint32_t Price() const { return ReadU32(data_ + 32); }
+        std::uint64_t MatchNumber() const { return ReadU64(data_ + 36); }
+    };
+
+    // Call handler(MessageView) for every complete frame in [data, data + size). Returns the bytes used,
+    // less than size when the stream ends inside a frame
+    template <typename Handler>
+    std::size_t ForEachMessage(const std::uint8_t* data, std::size_t size, Handler&& handler)
+    {
+        std::size_t offset = 0;
+        while (size - offset >= 2) {
+            const std::size_t length = ReadU16(data + offset);
+            if (size - offset - 2 < length || length == 0)
+                break;
+            handler(MessageView{data + offset + 2, length});
+            offset += 2 + length;
+        }
+        return offset;
+    }
+}
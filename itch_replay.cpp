@@ -0,0 +1,159 @@
+#include "feed_handler.hpp"
+#include "mapped_file.hpp"
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+ * Replays an ITCH 5.0 file (NASDAQ's daily TotalView-ITCH files, or what the server writes with --market-data)
+ * through the engine: FeedHandler rebuilds one OrderBook per symbol. The file is mapped and decoded in place.
+ * Every --checkpoint messages it prints the message rate and the books with the most resting orders, and at the
+ * end the totals, with the hardware counters per message over the whole replay unless --no-perf is given.
+ * --price-scale is the tick in ten-thousandths, 100 for cents. Prices between two ticks (sub-penny quotes) are
+ * rounded away from the spread and counted in the totals; --price-scale 1 keeps every ITCH price exactly.
+ *
+ * usage: order_book_itch_replay FILE [--symbols AAPL,MSFT] [--checkpoint N] [--top K] [--price-scale S] [--no-perf]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::string path_;
+        std::vector<std::string> symbols_;
+        std::uint64_t checkpoint_ {10'000'000};
+        std::size_t top_ {5};
+        std::uint32_t priceScale_ {100}; // Ticks of cents
+        bool perf_ {true};
+    };
+
+    std::string FormatLevel(const LevelInfos& levels, std::uint32_t priceScale)
+    {
+        if (levels.empty())
+            return "-";
+        char text[64];
+        std::snprintf(text, sizeof(text), "%u@%.4f", levels.front().quantity_, levels.front().price_ * static_cast<double>(priceScale) / 10000.0);
+        return text;
+    }
+
+    void PrintBooks(const FeedHandler& handler, const Options& options)
+    {
+        auto symbols = handler.GetSymbols();
+        const auto count = std::min(options.top_, symbols.size());
+        std::partial_sort(symbols.begin(), symbols.begin() + count, symbols.end(),
+            [](const FeedHandler::Symbol* left, const FeedHandler::Symbol* right) { return left->book_->Size() > right->book_->Size(); });
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& symbol = *symbols[i];
+            const auto infos = symbol.book_->GetOrderInfos();
+            std::printf("  %-8s orders=%-8zu levels=%zu/%zu bid=%s ask=%s\n", symbol.name_.c_str(), symbol.book_->Size(),
+                infos.GetBids().size(), infos.GetAsks().size(),
+                FormatLevel(infos.GetBids(), options.priceScale_).c_str(), FormatLevel(infos.GetAsks(), options.priceScale_).c_str());
+        }
+    }
+
+    void Replay(const Options& options)
+    {
+        const MappedFile file{options.path_};
+        FeedHandler handler{options.priceScale_, options.symbols_};
+        const auto& statistics = handler.GetStatistics();
+
+        std::unique_ptr<PerfCounters> counters;
+        if (options.perf_) {
+            counters = std::make_unique<PerfCounters>();
+            if (!counters->Available()) {
+                std::cout << "perf counters unavailable (" << counters->Error() << ")" << std::endl;
+                counters.reset();
+            }
+        }
+
+        if (counters)
+            counters->Start();
+        const auto start = Clock::now();
+        auto lastCheckpoint = start;
+        std::uint64_t lastMessages = 0;
+        const auto used = Itch::ForEachMessage(file.Data(), file.Size(), [&](const Itch::MessageView& message) {
+            handler.Apply(message);
+            if (statistics.messages_ % options.checkpoint_ != 0)
+                return;
+
+            const auto now = Clock::now();
+            const auto interval = std::chrono::duration<double>(now - lastCheckpoint).count();
+            std::printf("checkpoint messages=%llu elapsed=%.2fs rate=%.0f/s symbols=%zu\n",
+                static_cast<unsigned long long>(statistics.messages_), std::chrono::duration<double>(now - start).count(),
+                (statistics.messages_ - lastMessages) / interval, handler.GetSymbols().size());
+            PrintBooks(handler, options);
+            lastCheckpoint = now;
+            lastMessages = statistics.messages_;
+        });
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const auto values = counters ? counters->Stop() : PerfCounterValues{};
+
+        std::printf("done messages=%llu bytes=%zu elapsed=%.2fs rate=%.0f/s symbols=%zu\n",
+            static_cast<unsigned long long>(statistics.messages_), used, seconds, statistics.messages_ / seconds,
+            handler.GetSymbols().size());
+        if (counters)
+            std::printf("  %s\n", FormatPerfCounters(values, statistics.messages_).c_str());
+        std::printf("  adds=%llu executions=%llu cancels=%llu deletes=%llu replaces=%llu trades=%llu ignored=%llu\n",
+            static_cast<unsigned long long>(statistics.adds_), static_cast<unsigned long long>(statistics.executions_),
+            static_cast<unsigned long long>(statistics.cancels_), static_cast<unsigned long long>(statistics.deletes_),
+            static_cast<unsigned long long>(statistics.replaces_), static_cast<unsigned long long>(statistics.trades_),
+            static_cast<unsigned long long>(statistics.ignored_));
+        std::printf("  malformed=%llu unknown=%llu duplicate=%llu crossed shares=%llu sub-tick prices=%llu\n",
+            static_cast<unsigned long long>(statistics.malformed_), static_cast<unsigned long long>(statistics.unknownOrders_),
+            static_cast<unsigned long long>(statistics.duplicateOrders_), static_cast<unsigned long long>(statistics.crossedShares_),
+            static_cast<unsigned long long>(statistics.subTickPrices_));
+        if (used != file.Size())
+            std::printf("  the file ends inside a message, %zu bytes left\n", file.Size() - used);
+        PrintBooks(handler, options);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--symbols") == 0 && i + 1 < argc) {
+            std::istringstream symbols{argv[++i]};
+            for (std::string symbol; std::getline(symbols, symbol, ',');)
+                options.symbols_.push_back(symbol);
+        }
+        else if (std::strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc)
+            options.checkpoint_ = std::max<std::uint64_t>(1, std::stoull(argv[++i]));
+        else if (std::strcmp(argv[i], "--top") == 0 && i + 1 < argc)
+            options.top_ = std::stoul(argv[++i]);
+        else if (std::strcmp(argv[i], "--price-scale") == 0 && i + 1 < argc)
+            options.priceScale_ = static_cast<std::uint32_t>(std::max(1ul, std::stoul(argv[++i])));
+        else if (std::strcmp(argv[i], "--no-perf") == 0)
+            options.perf_ = false;
+        else if (argv[i][0] != '-' && options.path_.empty())
+            options.path_ = argv[i];
+        else {
+            options.path_.clear();
+            break;
+        }
+    }
+
+    if (options.path_.empty()) {
+        std::cerr << "usage: " << argv[0] << " FILE [--symbols AAPL,MSFT] [--checkpoint N] [--top K] [--price-scale S] [--no-perf]\n"
+                  << "  --price-scale S  tick in ten-thousandths, 100 for cents; prices between ticks are rounded away from the\n"
+                  << "                   spread and counted as sub-tick, 1 keeps them exact" << std::endl;
+        return 1;
+    }
+
+    try {
+        Replay(options);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include "tcp_gateway.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+#include "orderbook.grpc.pb.h"
+
+/*
+ * Loopback load generator for the order entry endpoints of the server, to compare them on one machine.
+ * Every endpoint gets the same flow: buy orders that rest at 99.99, each cancelled right after,
+ * so the book stays small. Binary TCP keeps up to --window requests in flight. A unary gRPC call has one.
+ * Reports throughput and the round trip of every request, from send until its response is read.
+ *
+ * usage: order_book_load [--tcp PORT] [--grpc HOST:PORT] [--host HOST] [--requests N] [--window W] [--first-id ID]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::string host_ {"127.0.0.1"};
+        std::optional<std::uint16_t> tcpPort_;
+        std::optional<std::string> grpcTarget_;
+        std::size_t requests_ {100000};
+        std::size_t window_ {1};
+        OrderId firstId_ {1'000'000'000}; // Far from what other clients use
+    };
+
+    constexpr Price RestingPrice = 9999; // Cents
+
+    void Report(const std::string& name, std::vector<std::uint64_t>& latencies, Clock::duration elapsed, std::size_t rejected)
+    {
+        if (latencies.empty())
+            return;
+
+        std::sort(latencies.begin(), latencies.end());
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+        const auto quantile = [&](double p) { return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]; };
+        std::printf("%-10s requests=%-8zu %10.0f/s p50=%7lluns p99=%8lluns max=%9lluns rejected=%zu\n",
+            name.c_str(), latencies.size(), latencies.size() / seconds,
+            static_cast<unsigned long long>(quantile(0.50)), static_cast<unsigned long long>(quantile(0.99)),
+            static_cast<unsigned long long>(latencies.back()), rejected);
+    }
+
+    std::uint64_t Nanoseconds(Clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+
+    // Request i of the flow: an add for even i, the cancel of that add for odd i
+    GatewayRequest FlowRequest(const Options& options, std::size_t i)
+    {
+        const OrderId orderId = options.firstId_ + i / 2;
+        if (i % 2)
+            return MakeCancelRequest(0, orderId);
+
+        OrderEntry entry;
+        entry.orderId_ = orderId;
+        entry.side_ = Side::Buy;
+        entry.price_ = RestingPrice;
+        entry.quantity_ = 10;
+        return MakeAddRequest(0, entry);
+    }
+
+    void RunTcp(const Options& options)
+    {
+        TcpGatewayClient client{options.host_, *options.tcpPort_};
+        std::vector<Clock::time_point> sent(options.requests_);
+        std::vector<std::uint64_t> latencies;
+        latencies.reserve(options.requests_);
+        std::size_t rejected = 0;
+
+        const auto start = Clock::now();
+        std::size_t next = 0;
+        SequencedResponse response;
+        while (latencies.size() < options.requests_) {
+            for (; next < options.requests_ && next - latencies.size() < options.window_; ++next) {
+                sent[next] = Clock::now();
+                client.Send(FlowRequest(options, next));
+            }
+            if (!client.Receive(response)) {
+                std::cerr << "tcp: the server closed the session" << std::endl;
+                break;
+            }
+            // Session sequences start at 1 and responses come back in order
+            latencies.push_back(Nanoseconds(sent[response.response_.sequence_ - 1]));
+            rejected += response.response_.status_ != static_cast<std::uint8_t>(GatewayStatus::Accepted);
+        }
+        Report("tcp", latencies, Clock::now() - start, rejected);
+    }
+
+    void RunGrpc(const Options& options)
+    {
+        auto stub = orderbook::OrderBookService::NewStub(grpc::CreateChannel(*options.grpcTarget_, grpc::InsecureChannelCredentials()));
+        std::vector<std::uint64_t> latencies;
+        latencies.reserve(options.requests_);
+        std::size_t rejected = 0;
+
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < options.requests_; ++i) {
+            const auto request = FlowRequest(options, i);
+            grpc::ClientContext context;
+            orderbook::OrderResponse response;
+            const auto sentAt = Clock::now();
+            grpc::Status status;
+            if (i % 2) {
+                orderbook::CancelOrderRequest cancel;
+                cancel.set_order_id(static_cast<std::int32_t>(request.orderId_));
+                status = stub->CancelOrder(&context, cancel, &response);
+            }
+            else {
+                orderbook::AddOrderRequest add;
+                add.set_order_id(static_cast<std::int32_t>(request.orderId_));
+                add.set_side("Buy");
+                add.set_price(request.price_ / 100.0);
+                add.set_quantity(static_cast<std::int32_t>(request.quantity_));
+                add.set_order_type("GoodTillCancel");
+                status = stub->AddOrder(&context, add, &response);
+            }
+            latencies.push_back(Nanoseconds(sentAt));
+            if (!status.ok()) {
+                std::cerr << "grpc: " << status.error_message() << std::endl;
+                break;
+            }
+            rejected += !response.success();
+        }
+        Report("grpc", latencies, Clock::now() - start, rejected);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--tcp") == 0 && i + 1 < argc)
+            options.tcpPort_ = static_cast<std::uint16_t>(std::stoul(argv[++i]));
+        else if (std::strcmp(argv[i], "--grpc") == 0 && i + 1 < argc)
+            options.grpcTarget_ = argv[++i];
+        else if (std::strcmp(argv[i], "--host") == 0 && i + 1 < argc)
+            options.host_ = argv[++i];
+        else if (std::strcmp(argv[i], "--requests") == 0 && i + 1 < argc)
+            options.requests_ = std::stoull(argv[++i]);
+        else if (std::strcmp(argv[i], "--window") == 0 && i + 1 < argc)
+            options.window_ = std::max<std::size_t>(1, std::stoull(argv[++i]));
+        else if (std::strcmp(argv[i], "--first-id") == 0 && i + 1 < argc)
+            options.firstId_ = std::stoull(argv[++i]);
+        else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--tcp PORT] [--grpc HOST:PORT] [--host HOST] [--requests N] [--window W] [--first-id ID]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!options.tcpPort_ && !options.grpcTarget_) {
+        std::cerr << "nothing to load: give --tcp and/or --grpc" << std::endl;
+        return 1;
+    }
+
+    try {
+        if (options.tcpPort_)
+            RunTcp(options);
+        if (options.grpcTarget_)
+            RunGrpc(options);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include "mapped_file.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        close(fd);
+        throw std::runtime_error("Cannot stat " + path + ": " + std::strerror(errno));
+    }
+
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ > 0) {
+        void* memory = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (memory == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Cannot map " + path + ": " + std::strerror(errno));
+        }
+        madvise(memory, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const std::uint8_t*>(memory);
+    }
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+        munmap(const_cast<std::uint8_t*>(data_), size_);
+}
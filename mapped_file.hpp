@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A file mapped read only for one sequential pass, the replay tools decode their input in place
+class MappedFile
+{
+    public:
+        // std::runtime_error if the file cannot be opened or mapped
+        explicit MappedFile(const std::string& path);
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        const std::uint8_t* Data() const { return data_; }
+        std::size_t Size() const { return size_; }
+
+    private:
+        const std::uint8_t* data_ {nullptr};
+        std::size_t size_ {0};
+};
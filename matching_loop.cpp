@@ -0,0 +1,95 @@
+#include "matching_loop.hpp"
+#include "thread_affinity.hpp"
+
+MatchingLoop::MatchingLoop(MatchingLoopOptions options)
+: options_{options}
+{
+    thread_ = std::thread{ [this] { Loop(); } };
+    if (options_.cpu_)
+        pinned_ = PinThread(thread_.native_handle(), *options_.cpu_);
+}
+
+MatchingLoop::~MatchingLoop()
+{
+    {
+        std::scoped_lock lock{mutex_};
+        shutdown_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+}
+
+void MatchingLoop::Submit(std::function<void()> function)
+{
+    {
+        std::scoped_lock lock{mutex_};
+        queue_.push_back(Task{std::move(function), std::chrono::steady_clock::now()});
+        pending_.store(true, std::memory_order_release);
+    }
+    // Cheap when the thread is spinning: there is no waiter to wake
+    condition_.notify_one();
+}
+
+void MatchingLoop::SetPoller(std::function<bool()> poller)
+{
+    Run([&] { poller_ = std::move(poller); });
+}
+
+bool MatchingLoop::Ready()
+{
+    const bool polled = poller_ && poller_();
+    return polled || pending_.load(std::memory_order_acquire);
+}
+
+bool MatchingLoop::WaitForTasks()
+{
+    for (std::uint32_t i = 0; i < options_.spinIterations_; ++i) {
+        if (Ready())
+            return true;
+        CpuRelax();
+    }
+
+    for (std::uint32_t i = 0; i < options_.yieldIterations_; ++i) {
+        if (Ready())
+            return true;
+        std::this_thread::yield();
+    }
+
+    if (!poller_) {
+        std::unique_lock lock{mutex_};
+        condition_.wait(lock, [this] { return !queue_.empty() || shutdown_; });
+        return !queue_.empty();
+    }
+
+    // What the poller serves cannot wake the thread, so it only dozes
+    if (Ready())
+        return true;
+    std::unique_lock lock{mutex_};
+    condition_.wait_for(lock, ParkedPollInterval, [this] { return !queue_.empty() || shutdown_; });
+    return !queue_.empty() || !shutdown_;
+}
+
+void MatchingLoop::Loop()
+{
+    std::vector<Task> tasks;
+    while (WaitForTasks()) {
+        {
+            std::scoped_lock lock{mutex_};
+            tasks.swap(queue_);
+            pending_.store(false, std::memory_order_relaxed);
+            // A busy poller keeps WaitForTasks from ever seeing the shutdown
+            if (tasks.empty() && shutdown_)
+                break;
+        }
+        if (tasks.empty())
+            continue; // Only the poller had work
+
+        // Only the first task measures the wakeup, the others queued up behind it while the thread was busy
+        const auto waited = std::chrono::steady_clock::now() - tasks.front().submitted_;
+        wakeupLatency_.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count());
+
+        for (auto& task : tasks)
+            task.function_();
+        tasks.clear();
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "metrics.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/*
+ * Runs the order book calls of the server on one dedicated thread, so only that thread ever touches the book.
+ * Callers hand over a task and wait for its result; that includes timed work such as the GoodForDay prune at
+ * the close, which the server submits like any request.
+ * The thread can be pinned to an (isolated) CPU and busy-polls for tasks before parking: it polls
+ * spinIterations_ times with a pause in between, then yieldIterations_ times yielding to the scheduler,
+ * then sleeps on a condition variable until the next submit. With both at 0 it parks at once, which is the
+ * plain blocking behaviour. The time from submit to the thread picking the task up is kept in WakeupLatency,
+ * so both modes can be measured on the same machine.
+ * A poller (see SetPoller) lets the thread also serve sources that cannot submit, such as the shared memory
+ * gateway. It runs on every poll of the backoff, and while one is set the thread parks for at most
+ * ParkedPollInterval, so those sources want a spinning thread.
+ */
+struct MatchingLoopOptions {
+    std::optional<int> cpu_;            // CPU to pin the thread to, floating when empty
+    std::uint32_t spinIterations_ {};   // Polls with a pause instruction before yielding
+    std::uint32_t yieldIterations_ {};  // Polls with a yield before parking
+};
+
+class MatchingLoop
+{
+    private:
+        struct Task {
+            std::function<void()> function_;
+            std::chrono::steady_clock::time_point submitted_;
+        };
+
+        MatchingLoopOptions options_;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        std::vector<Task> queue_;
+        std::atomic<bool> pending_ {false}; // queue_ is not empty. What the thread polls without the lock
+        bool shutdown_ {false};
+        bool pinned_ {false};
+        LatencyHistogram wakeupLatency_;
+        std::function<bool()> poller_; // Only touched on the loop thread
+        std::thread thread_;
+
+        void Loop();
+        // Run the poller, then check for tasks. True if either found work
+        bool Ready();
+        // Back off as configured until there are tasks. False once shut down with nothing left to run
+        bool WaitForTasks();
+        void Submit(std::function<void()> function);
+
+    public:
+        static constexpr std::chrono::microseconds ParkedPollInterval {50};
+
+        explicit MatchingLoop(MatchingLoopOptions options = {});
+        MatchingLoop(const MatchingLoop&) = delete;
+        MatchingLoop& operator=(const MatchingLoop&) = delete;
+        // Runs what was already submitted, then stops the thread
+        ~MatchingLoop();
+
+        // Run function on the loop thread and return its result. Exceptions are rethrown to the caller
+        template <typename Function>
+        auto Run(Function function) -> decltype(function())
+        {
+            std::packaged_task<decltype(function())()> task { std::move(function) };
+            auto result = task.get_future();
+            Submit([&task] { task(); });
+            return result.get();
+        }
+
+        // Run poller on the loop thread whenever it looks for work. It returns whether it found any. Empty removes it
+        void SetPoller(std::function<bool()> poller);
+
+        // Whether the thread was pinned to the configured CPU
+        bool IsPinned() const { return pinned_; }
+        const MatchingLoopOptions& GetOptions() const { return options_; }
+        const LatencyHistogram& WakeupLatency() const { return wakeupLatency_; }
+};
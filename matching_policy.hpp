@@ -0,0 +1,93 @@
+#pragma once
+#include "types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Allocation rules for the orders resting at one price level, picked at compile time as the
+ * Matching type of the book's traits (see order_book_traits.hpp). A pro-rata policy only decides how much of an incoming quantity
+ * each resting order gets, the book does the fills. FIFO keeps the plain matching loop, so it costs
+ * nothing over a book without policies.
+ */
+
+// Price-time priority: a level fills strictly in arrival order
+struct FifoMatching {
+    static constexpr bool ProRata = false;
+};
+
+namespace detail {
+    // Split incoming over resting[0, count) in proportion to each quantity. Shares under minimum are dropped,
+    // whatever rounding and dropping leave over is handed out in time order. With topOrder the first order
+    // is filled in full before the rest is split
+    template <typename Quantity>
+    void AllocateProRata(Quantity incoming, const Quantity* resting, std::size_t count, Quantity* allocations,
+        Quantity minimum, bool topOrder)
+    {
+        // Wide enough for incoming * resting[i]
+        using Product = std::conditional_t<(sizeof(Quantity) > 4), unsigned __int128, std::uint64_t>;
+
+        std::fill(allocations, allocations + count, Quantity{0});
+
+        std::size_t first = 0;
+        if (topOrder && count > 0) {
+            allocations[0] = std::min(incoming, resting[0]);
+            incoming -= allocations[0];
+            first = 1;
+        }
+
+        Product total = 0;
+        for (std::size_t i = first; i < count; ++i)
+            total += resting[i];
+        if (incoming == 0 || total == 0)
+            return;
+
+        if (incoming >= total) {
+            std::copy(resting + first, resting + count, allocations + first);
+            return;
+        }
+
+        Quantity allocated = 0;
+        for (std::size_t i = first; i < count; ++i) {
+            const auto share = static_cast<Quantity>(static_cast<Product>(incoming) * resting[i] / total);
+            if (share >= minimum) {
+                allocations[i] += share;
+                allocated += share;
+            }
+        }
+
+        auto leftover = incoming - allocated;
+        for (std::size_t i = first; i < count && leftover > 0; ++i) {
+            const auto extra = std::min(leftover, resting[i] - allocations[i]);
+            allocations[i] += extra;
+            leftover -= extra;
+        }
+    }
+}
+
+// Each resting order gets a share of the incoming quantity proportional to its size, as on many futures venues.
+// Allocate takes the quantity type of the book it is used in
+template <Quantity MinimumAllocation = 2>
+struct ProRataMatching {
+    static constexpr bool ProRata = true;
+
+    template <typename QuantityType>
+    static void Allocate(QuantityType incoming, const QuantityType* resting, std::size_t count, QuantityType* allocations)
+    {
+        detail::AllocateProRata(incoming, resting, count, allocations, QuantityType{MinimumAllocation}, false);
+    }
+};
+
+// The order at the front of the level is filled first, the remainder is split pro-rata. The front order
+// stands in for the order that set the price, which this book does not track
+template <Quantity MinimumAllocation = 2>
+struct TopOrderProRataMatching {
+    static constexpr bool ProRata = true;
+
+    template <typename QuantityType>
+    static void Allocate(QuantityType incoming, const QuantityType* resting, std::size_t count, QuantityType* allocations)
+    {
+        detail::AllocateProRata(incoming, resting, count, allocations, QuantityType{MinimumAllocation}, true);
+    }
+};
@@ -0,0 +1,132 @@
+#include "metrics.hpp"
+#include <cstdio>
+#include <sstream>
+
+namespace {
+    const char* OrderTypeLabel(std::size_t index)
+    {
+        switch (static_cast<OrderType>(index)) {
+            case OrderType::GoodTillCancel: return "GoodTillCancel";
+            case OrderType::FillAndKill: return "FillAndKill";
+            case OrderType::FillOrKill: return "FillOrKill";
+            case OrderType::GoodForDay: return "GoodForDay";
+            case OrderType::Market: return "Market";
+            case OrderType::Iceberg: return "Iceberg";
+            case OrderType::Stop: return "Stop";
+            case OrderType::StopLimit: return "StopLimit";
+            case OrderType::PrimaryPeg: return "PrimaryPeg";
+            case OrderType::MidpointPeg: return "MidpointPeg";
+        }
+        return "Unknown";
+    }
+
+    void WriteHeader(std::ostringstream& out, const char* name, const char* help, const char* type)
+    {
+        out << "# HELP " << name << ' ' << help << '\n';
+        out << "# TYPE " << name << ' ' << type << '\n';
+    }
+
+    void WriteValue(std::ostringstream& out, const char* name, const std::atomic<std::uint64_t>& value)
+    {
+        out << name << ' ' << value.load(std::memory_order_relaxed) << '\n';
+    }
+
+    void WritePerType(std::ostringstream& out, const char* name, const std::array<EngineMetrics::Counter, OrderTypeCount>& values)
+    {
+        for (std::size_t type = 0; type < values.size(); ++type)
+            out << name << "{type=\"" << OrderTypeLabel(type) << "\"} " << values[type].load(std::memory_order_relaxed) << '\n';
+    }
+}
+
+std::string RenderMetrics(const EngineMetrics& metrics)
+{
+    std::ostringstream out;
+
+    WriteHeader(out, "orderbook_orders_added_total", "Orders accepted by the book.", "counter");
+    WritePerType(out, "orderbook_orders_added_total", metrics.ordersAdded_);
+
+    WriteHeader(out, "orderbook_orders_rejected_total", "Orders rejected on entry, such as FillAndKill or FillOrKill that could not fill.", "counter");
+    WritePerType(out, "orderbook_orders_rejected_total", metrics.ordersRejected_);
+
+    WriteHeader(out, "orderbook_orders_cancelled_total", "Orders removed from the book without being filled.", "counter");
+    WriteValue(out, "orderbook_orders_cancelled_total", metrics.ordersCancelled_);
+
+    WriteHeader(out, "orderbook_orders_amended_total", "Orders whose quantity was reduced in place, keeping their queue position.", "counter");
+    WriteValue(out, "orderbook_orders_amended_total", metrics.ordersAmended_);
+
+    WriteHeader(out, "orderbook_trades_total", "Trades executed.", "counter");
+    WriteValue(out, "orderbook_trades_total", metrics.trades_);
+
+    WriteHeader(out, "orderbook_auctions_total", "Call auctions uncrossed at an equilibrium price.", "counter");
+    WriteValue(out, "orderbook_auctions_total", metrics.auctions_);
+
+    WriteHeader(out, "orderbook_prune_runs_total", "End of day GoodForDay prune cycles.", "counter");
+    WriteValue(out, "orderbook_prune_runs_total", metrics.pruneRuns_);
+
+    WriteHeader(out, "orderbook_post_only_rejected_total", "Post only orders rejected because they would have crossed.", "counter");
+    WriteValue(out, "orderbook_post_only_rejected_total", metrics.postOnlyRejected_);
+
+    WriteHeader(out, "orderbook_post_only_slid_total", "Post only orders repriced one tick behind the opposite best price.", "counter");
+    WriteValue(out, "orderbook_post_only_slid_total", metrics.postOnlySlid_);
+
+    WriteHeader(out, "orderbook_self_trades_prevented_total", "Crosses between orders of the same owner resolved without a trade.", "counter");
+    WriteValue(out, "orderbook_self_trades_prevented_total", metrics.selfTradesPrevented_);
+
+    WriteHeader(out, "orderbook_stops_triggered_total", "Stop and stop limit orders whose stop price was reached.", "counter");
+    WriteValue(out, "orderbook_stops_triggered_total", metrics.stopsTriggered_);
+
+    WriteHeader(out, "orderbook_resting_orders", "Orders resting in the book.", "gauge");
+    WriteValue(out, "orderbook_resting_orders", metrics.restingOrders_);
+
+    WriteHeader(out, "orderbook_bid_levels", "Number of bid price levels.", "gauge");
+    WriteValue(out, "orderbook_bid_levels", metrics.bidLevels_);
+
+    WriteHeader(out, "orderbook_ask_levels", "Number of ask price levels.", "gauge");
+    WriteValue(out, "orderbook_ask_levels", metrics.askLevels_);
+
+    WriteHeader(out, "orderbook_pending_stop_orders", "Stop orders waiting outside the book.", "gauge");
+    WriteValue(out, "orderbook_pending_stop_orders", metrics.pendingStopOrders_);
+
+    WriteHeader(out, "orderbook_pegged_orders", "Pegged orders resting relative to the best bid or ask.", "gauge");
+    WriteValue(out, "orderbook_pegged_orders", metrics.peggedOrders_);
+
+    WriteHeader(out, "orderbook_memory_bytes", "Estimated memory held by the book containers.", "gauge");
+    WriteValue(out, "orderbook_memory_bytes", metrics.memoryBytes_);
+
+    return out.str();
+}
+
+std::uint64_t LatencyHistogram::Quantile(double p) const
+{
+    const auto count = count_.load(std::memory_order_relaxed);
+    if (count == 0)
+        return 0;
+
+    const auto rank = static_cast<std::uint64_t>(p * static_cast<double>(count - 1));
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < Buckets; ++bucket) {
+        seen += buckets_[bucket].load(std::memory_order_relaxed);
+        if (seen > rank)
+            return std::uint64_t{1} << bucket;
+    }
+    return std::uint64_t{1} << (Buckets - 1);
+}
+
+std::string RenderHistogram(const char* name, const char* help, const LatencyHistogram& histogram)
+{
+    std::ostringstream out;
+    WriteHeader(out, name, help, "histogram");
+
+    // Buckets are cumulative in the exposition format
+    std::uint64_t cumulative = 0;
+    for (std::size_t bucket = 0; bucket + 1 < LatencyHistogram::Buckets; ++bucket) {
+        cumulative += histogram.buckets_[bucket].load(std::memory_order_relaxed);
+        char bound[32];
+        std::snprintf(bound, sizeof(bound), "%.9g", static_cast<double>(std::uint64_t{1} << bucket) / 1e9);
+        out << name << "_bucket{le=\"" << bound << "\"} " << cumulative << '\n';
+    }
+    out << name << "_bucket{le=\"+Inf\"} " << histogram.count_.load(std::memory_order_relaxed) << '\n';
+    out << name << "_sum " << static_cast<double>(histogram.sumNanoseconds_.load(std::memory_order_relaxed)) / 1e9 << '\n';
+    out << name << "_count " << histogram.count_.load(std::memory_order_relaxed) << '\n';
+    return out.str();
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "types.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/*
+ * Counters and gauges published by the matching engine.
+ * Everything is a relaxed atomic written from the matching path and read by the exporter without
+ * taking ordersMutex_, so collecting stats never stalls matching. A snapshot is therefore not a
+ * consistent cut across metrics, which is fine for monitoring.
+ */
+struct EngineMetrics {
+    using Counter = std::atomic<std::uint64_t>;
+    using Gauge = std::atomic<std::uint64_t>;
+
+    // Counters
+    std::array<Counter, OrderTypeCount> ordersAdded_ {};    // Accepted by AddOrder, per order type
+    std::array<Counter, OrderTypeCount> ordersRejected_ {}; // Rejected on entry (FAK/FOK that cannot fill, market into an empty book)
+    Counter ordersCancelled_ {0};
+    Counter ordersAmended_ {0};  // Quantity reductions done in place, modifies that replace the order count as cancel and add
+    Counter trades_ {0};
+    Counter pruneRuns_ {0};
+    Counter auctions_ {0};  // Call auctions that uncrossed at an equilibrium price
+    Counter postOnlyRejected_ {0};  // Post only orders that would have crossed on entry
+    Counter postOnlySlid_ {0};      // Post only orders repriced to rest instead of crossing
+    Counter selfTradesPrevented_ {0};  // Crosses between orders of the same owner resolved without a trade
+    Counter stopsTriggered_ {0};  // Stop orders released into the book (they are counted again under their new type)
+
+    // Gauges
+    Gauge restingOrders_ {0};
+    Gauge bidLevels_ {0};
+    Gauge askLevels_ {0};
+    Gauge pendingStopOrders_ {0};
+    Gauge peggedOrders_ {0};  // Also counted in restingOrders_
+    Gauge memoryBytes_ {0};  // Estimated footprint of the book containers
+
+    static void Increment(Counter& counter, std::uint64_t amount = 1)
+    {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    static std::size_t Index(OrderType type) { return static_cast<std::size_t>(type); }
+
+    static void Set(Gauge& gauge, std::uint64_t value) { gauge.store(value, std::memory_order_relaxed); }
+};
+
+// Power of two latency histogram: bucket i counts samples under 2^i nanoseconds, the last one everything above
+struct LatencyHistogram {
+    static constexpr std::size_t Buckets = 32;
+
+    std::array<EngineMetrics::Counter, Buckets> buckets_ {};
+    EngineMetrics::Counter count_ {0};
+    EngineMetrics::Counter sumNanoseconds_ {0};
+
+    void Record(std::uint64_t nanoseconds)
+    {
+        std::size_t bucket = 0;
+        while (bucket + 1 < Buckets && (std::uint64_t{1} << bucket) <= nanoseconds)
+            ++bucket;
+        EngineMetrics::Increment(buckets_[bucket]);
+        EngineMetrics::Increment(count_);
+        EngineMetrics::Increment(sumNanoseconds_, nanoseconds);
+    }
+
+    // Upper bound of the bucket holding the p quantile, 0 without samples
+    std::uint64_t Quantile(double p) const;
+};
+
+// Render the metrics in the Prometheus text exposition format
+std::string RenderMetrics(const EngineMetrics& metrics);
+// Render a latency histogram as a Prometheus histogram in seconds
+std::string RenderHistogram(const char* name, const char* help, const LatencyHistogram& histogram);
@@ -1,32 +1,90 @@
 #pragma once
 #include "types.hpp"
 #include "Constants.h"
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <list>
 
 
-// Represents a single order in the order book
-class Order {
+// Represents a single order in the order book. PriceType and QuantityType set the widths of its prices and
+// quantities, Order below uses the default ones
+template <typename PriceType, typename QuantityType>
+class BasicOrder {
     public: 
-        Order(OrderType orderType, OrderId orderId, Side side, Price price, Quantity quantity)
-        : orderType_{orderType}, orderId_{orderId}, side_{side}, price_{price}, initialQuantity_{quantity}, remainingQuantity_{quantity}
+        using Price = PriceType;
+        using Quantity = QuantityType;
+        using PegOffset = BasicPegOffset<Price>;
+
+        BasicOrder(OrderType orderType, OrderId orderId, Side side, Price price, Quantity quantity)
+        : orderType_{orderType}, orderId_{orderId}, side_{side}, price_{price}, initialQuantity_{quantity}, remainingQuantity_{quantity},
+          displayQuantity_{quantity}
         { }
 
+        // Iceberg order: only displayQuantity is visible in the book, the rest waits in the reserve
+        BasicOrder(OrderId orderId, Side side, Price price, Quantity quantity, Quantity displayQuantity)
+        : BasicOrder(OrderType::Iceberg, orderId, side, price, quantity)
+        {
+            if (displayQuantity == 0)
+                throw std::logic_error("Iceberg order " + std::to_string(orderId) + " needs a display quantity");
+
+            displayQuantity_ = std::min(displayQuantity, quantity);
+            remainingQuantity_ = displayQuantity_;
+            reserveQuantity_ = quantity - displayQuantity_;
+        }
+
+        // Stop (price is ignored) and stop limit orders, parked until the last trade price reaches stopPrice
+        BasicOrder(OrderType orderType, OrderId orderId, Side side, Price price, Price stopPrice, Quantity quantity)
+        : BasicOrder(orderType, orderId, side, price, quantity)
+        {
+            if (orderType != OrderType::Stop && orderType != OrderType::StopLimit)
+                throw std::logic_error("Only stop orders take a stop price. Not order " + std::to_string(orderId));
+
+            stopPrice_ = stopPrice;
+        }
+
+        // Pegged order. Its price is not fixed, the book evaluates it against the best bid and ask when needed
+        BasicOrder(OrderType orderType, OrderId orderId, Side side, PegOffset pegOffset, Quantity quantity)
+        : BasicOrder(orderType, orderId, side, Constants::InvalidPrice, quantity)
+        {
+            if (orderType != OrderType::PrimaryPeg && orderType != OrderType::MidpointPeg)
+                throw std::logic_error("Only pegged orders take a peg offset. Not order " + std::to_string(orderId));
+            if ((side == Side::Buy && pegOffset.offset_ > 0) || (side == Side::Sell && pegOffset.offset_ < 0))
+                throw std::logic_error("Peg offset of order " + std::to_string(orderId) + " would be more aggressive than its reference");
+
+            pegOffset_ = pegOffset.offset_;
+        }
+
         // Overload the order, that does not take a price. This is for market orders where price does not matter
-        Order (OrderId orderId, Side side, Quantity quantity)
-        : Order(OrderType::Market, orderId, side, Constants::InvalidPrice, quantity)
+        BasicOrder (OrderId orderId, Side side, Quantity quantity)
+        : BasicOrder(OrderType::Market, orderId, side, Constants::InvalidPrice, quantity)
         {}
         OrderId GetOrderId() const { return orderId_; }
         Side GetSide() const { return side_; }
         Price GetPrice() const { return price_; }
         OrderType GetOrderType() const { return orderType_; }
+        Price GetStopPrice() const { return stopPrice_; }
+        bool IsStopOrder() const { return orderType_ == OrderType::Stop || orderType_ == OrderType::StopLimit; }
+        Price GetPegOffset() const { return pegOffset_; }
+        PostOnly GetPostOnly() const { return postOnly_; }
+        OwnerId GetOwner() const { return owner_; }
+        SelfTradePrevention GetSelfTradePrevention() const { return selfTradePrevention_; }
+        // Arrival order in the book, larger is newer
+        std::uint64_t GetSequence() const { return sequence_; }
+        bool IsPegged() const { return orderType_ == OrderType::PrimaryPeg || orderType_ == OrderType::MidpointPeg; }
         Quantity GetInitialQuantity() const { return initialQuantity_; }
+        // Visible quantity left. For icebergs this is the current tranche only
         Quantity GetRemainingQuantity() const { return remainingQuantity_; }
-        Quantity GetFilledQuantity() const { return initialQuantity_ - remainingQuantity_; }
+        Quantity GetDisplayQuantity() const { return displayQuantity_; }
+        Quantity GetReserveQuantity() const { return reserveQuantity_; }
+        // Everything still to be filled, visible and reserve
+        Quantity GetOpenQuantity() const { return remainingQuantity_ + reserveQuantity_; }
+        Quantity GetFilledQuantity() const { return initialQuantity_ - remainingQuantity_ - reserveQuantity_; }
 
-        bool IsFilled() const { return GetRemainingQuantity() == 0; }
+        bool IsFilled() const { return GetRemainingQuantity() == 0 && GetReserveQuantity() == 0; }
+        // The visible tranche of an iceberg is used up but its reserve is not
+        bool NeedsReplenish() const { return GetRemainingQuantity() == 0 && GetReserveQuantity() > 0; }
         void Fill(Quantity quantity)
         {
             if (quantity > GetRemainingQuantity())
@@ -36,6 +94,60 @@ class Order {
             remainingQuantity_ -= quantity;
         }
 
+        // Load the next tranche from the reserve and return the newly visible quantity
+        Quantity Replenish()
+        {
+            if (!NeedsReplenish())
+                throw std::logic_error("Order " + std::to_string(GetOrderId()) + " has no tranche to replenish");
+
+            remainingQuantity_ = std::min(displayQuantity_, reserveQuantity_);
+            reserveQuantity_ -= remainingQuantity_;
+            return remainingQuantity_;
+        }
+
+
+        // Lower the open quantity in place, keeping time priority. The reserve of an iceberg goes first.
+        // Returns how much the visible quantity went down
+        Quantity ReduceQuantity(Quantity quantity)
+        {
+            if (quantity == 0 || quantity >= GetOpenQuantity())
+                throw std::logic_error("Order " + std::to_string(GetOrderId()) + " can only be reduced to a smaller non zero quantity");
+
+            const auto reduction = GetOpenQuantity() - quantity;
+            const auto fromReserve = std::min(reduction, reserveQuantity_);
+            initialQuantity_ -= reduction;
+            reserveQuantity_ -= fromReserve;
+            remainingQuantity_ -= reduction - fromReserve;
+            return reduction - fromReserve;
+        }
+
+        // Only orders that rest at their own limit price can be post only
+        void SetPostOnly(PostOnly postOnly)
+        {
+            if (postOnly != PostOnly::Off && orderType_ != OrderType::GoodTillCancel && orderType_ != OrderType::GoodForDay
+                && orderType_ != OrderType::Iceberg)
+                throw std::logic_error("Only resting limit orders can be post only. Not order " + std::to_string(GetOrderId()));
+
+            postOnly_ = postOnly;
+        }
+
+        void SetOwner(OwnerId owner, SelfTradePrevention selfTradePrevention = SelfTradePrevention::CancelNewest)
+        {
+            owner_ = owner;
+            selfTradePrevention_ = selfTradePrevention;
+        }
+
+        // Stamped by the book when the order enters it
+        void SetSequence(std::uint64_t sequence) { sequence_ = sequence; }
+
+        // Reprice a sliding post only order that would have crossed
+        void Slide(Price price)
+        {
+            if (postOnly_ != PostOnly::Slide)
+                throw std::logic_error("Only sliding post only orders can be repriced. Not order " + std::to_string(GetOrderId()));
+
+            price_ = price;
+        }
 
         void ToGoodTillCancel(Price price) 
         { 
@@ -46,6 +158,20 @@ class Order {
             orderType_ = OrderType::GoodTillCancel;
         }
 
+        // A stop order whose stop price was reached enters the book as a market order, a stop limit as a good till cancel
+        void Trigger()
+        {
+            if (!IsStopOrder())
+                throw std::logic_error("Only stop orders can be triggered. Not order " + std::to_string(GetOrderId()));
+
+            if (orderType_ == OrderType::Stop) {
+                orderType_ = OrderType::Market;
+                price_ = Constants::InvalidPrice;
+            }
+            else
+                orderType_ = OrderType::GoodTillCancel;
+        }
+
     private:
         OrderType orderType_;      // Type of the order (GTC or FOK)
         OrderId orderId_;          // Unique identifier for the order
@@ -53,8 +179,18 @@ class Order {
         Price price_;             // Price at which the order is placed
         Quantity initialQuantity_; // Original quantity of the order
         Quantity remainingQuantity_; // Remaining quantity to be filled
+        Quantity displayQuantity_;   // Size of each visible tranche (equal to the quantity for non icebergs)
+        Quantity reserveQuantity_ {}; // Hidden quantity not yet shown in the book
+        Price stopPrice_ {Constants::InvalidPrice}; // Trigger price of stop and stop limit orders
+        Price pegOffset_ {}; // Offset from the reference price of pegged orders
+        PostOnly postOnly_ {PostOnly::Off};
+        OwnerId owner_ {Constants::NoOwner};
+        SelfTradePrevention selfTradePrevention_ {SelfTradePrevention::CancelNewest};
+        std::uint64_t sequence_ {};
 };
 
+using Order = BasicOrder<Price, Quantity>;
+
 // Smart pointer type for Order objects
 using OrderPointer = std::shared_ptr<Order>;
 // List of order pointers for maintaining order sequence at each price level
@@ -1,83 +1,144 @@
 #include "order_book.hpp"
 #include "types.hpp"
+#include "itch_encoder.hpp"
+#include "trade_tape.hpp"
+#include "bar_aggregator.hpp"
+#include "trace.hpp"
 #include <atomic>
 #include <chrono>
-#include <condition_variable>
+#include <cstdlib>
 #include <ctime>
 #include <mutex>
 #include <numeric>
+#include <optional>
+#include <stdexcept>
 #include <iostream>
 
 
+template <typename Traits>
+template <typename Function>
+decltype(auto) BasicOrderBook<Traits>::VisitSourceLevels(Side side, typename MatchSource::Kind kind, Function function) {
+    if (side == Side::Buy) {
+        if (kind == MatchSource::Kind::Limit)
+            return function(bids_);
+        return function(kind == MatchSource::Kind::PrimaryPeg ? buyPegs_.primary_ : buyPegs_.midpoint_);
+    }
+    if (kind == MatchSource::Kind::Limit)
+        return function(asks_);
+    return function(kind == MatchSource::Kind::PrimaryPeg ? sellPegs_.primary_ : sellPegs_.midpoint_);
+}
 
-void OrderBook::PruneGoodForDayOrder() {
-    using namespace std::chrono;
-    const auto end = hours(16);
-
-    while(true) {
-        const auto now = system_clock::now();
-        const auto now_c = system_clock::to_time_t(now);
-        std::tm now_parts;
-        localtime_r(&now_c, &now_parts);
+template <typename Traits>
+std::chrono::system_clock::time_point BasicOrderBook<Traits>::NextGoodForDayClose(std::chrono::system_clock::time_point now) {
+    constexpr int CloseHour = 16;
+    const auto nowTime = std::chrono::system_clock::to_time_t(now);
+    std::tm close;
+    localtime_r(&nowTime, &close);
+
+    // At or past 4 pm it is tomorrow's close
+    if (close.tm_hour >= CloseHour)
+        close.tm_mday += 1;
+    close.tm_hour = CloseHour;
+    close.tm_min = 0;
+    close.tm_sec = 0;
+    close.tm_isdst = -1;
+    return std::chrono::system_clock::from_time_t(std::mktime(&close));
+}
 
-        // if past 4 pm, go to next day
-        if(now_parts.tm_hour >= end.count()) 
-            now_parts.tm_mday += 1;
+template <typename Traits>
+std::size_t BasicOrderBook<Traits>::PruneGoodForDay() {
+    OrderIds orderIds;
+    {
+        std::scoped_lock ordersLock{ordersMutex_};
+        for (const auto& [orderId, entry] : orders_)
+            if (entry.order_->GetOrderType() == OrderType::GoodForDay)
+                orderIds.push_back(orderId);
+    }
 
-        now_parts.tm_hour = end.count();
-        now_parts.tm_min = 0;
-        now_parts.tm_sec = 0;
+    EngineMetrics::Increment(metrics_.pruneRuns_);
+    Tracer::Record(TraceEventType::PruneBegin, 0, TraceSide::None, 0, orderIds.size());
+    CancelOrders(orderIds);
+    Tracer::Record(TraceEventType::PruneEnd, 0, TraceSide::None, 0, orderIds.size());
+    return orderIds.size();
+}
 
+template <typename Traits>
+void BasicOrderBook<Traits>::CancelOrders(OrderIds orderIds) {
+    std::scoped_lock ordersLock{ordersMutex_};  // Lock once for all cancellations
+    
+    for(const auto& orderId : orderIds) {
+        // Use CancelOrderInternal because we already have the lock
+        CancelOrderInternal(orderId);
+    }
+}  // Lock is released here
 
-        // how far are we until 4 pm
-        auto next = system_clock::from_time_t(mktime(&now_parts));
-        auto till = next - now +milliseconds(100);
 
-        {
-            std::unique_lock ordersLock{ ordersMutex_};
-            if (shutdown_.load(std::memory_order_acquire) ||
-            shutdownConditionVariable_.wait_for(ordersLock, till) == std::cv_status::no_timeout)
-                return;
-        }
+template <typename Traits>
+typename BasicOrderBook<Traits>::OrderPointers::iterator BasicOrderBook<Traits>::LinkOwner(const OrderPointer& order) {
+    if (order->GetOwner() == Constants::NoOwner)
+        return {};
 
-        OrderIds orderIds;
-        {
-            std::scoped_lock ordersLock {ordersMutex_};
-            for (const auto& [orderId, entry] : orders_) {
-                const auto& [order, _] = entry;
+    auto& orders = ownerOrders_[order->GetOwner()];
+    orders.push_back(order);
+    return std::prev(orders.end());
+}
 
-                if (order->GetOrderType() != OrderType::GoodForDay)
-                    continue;
+template <typename Traits>
+void BasicOrderBook<Traits>::EraseEntry(OrderIndex& index, OrderId orderId) {
+    auto entry = index.find(orderId);
+    if (const auto owner = entry->second.order_->GetOwner(); owner != Constants::NoOwner) {
+        auto ownerOrders = ownerOrders_.find(owner);
+        ownerOrders->second.erase(entry->second.ownerLocation_);
+        if (ownerOrders->second.empty())
+            ownerOrders_.erase(ownerOrders);
+    }
+    index.erase(entry);
+}
 
-                orderIds.push_back(order->GetOrderId());
-            }
+template <typename Traits>
+typename BasicOrderBook<Traits>::OrderPointer BasicOrderBook<Traits>::UnlinkOrder(OrderId orderId) {
+    // Stop orders never reached the book, so they only leave their trigger level
+    if (auto stop = stopOrders_.find(orderId); stop != stopOrders_.end()) {
+        const auto [order, iterator, _] = stop->second;
+        EraseEntry(stopOrders_, orderId);
+
+        auto RemoveStop = [&](auto& stops) {
+            auto& orders = stops.at(order->GetStopPrice());
+            orders.erase(iterator);
+            if (orders.empty())
+                stops.erase(order->GetStopPrice());
         };
-
-        
-        CancelOrders(orderIds);
-
-    } 
+        if (order->GetSide() == Side::Buy)
+            RemoveStop(buyStops_);
+        else
+            RemoveStop(sellStops_);
+        return order;
     }
 
+    if (auto peg = pegOrders_.find(orderId); peg != pegOrders_.end()) {
+        const auto [order, iterator, _] = peg->second;
+        EraseEntry(pegOrders_, orderId);
 
-void OrderBook::CancelOrders(OrderIds orderIds) {
-    std::scoped_lock ordersLock{ordersMutex_};  // Lock once for all cancellations
-    
-    for(const auto& orderId : orderIds) {
-        // Use CancelOrderInternal because we already have the lock
-        CancelOrderInternal(orderId);
+        auto RemovePeg = [&](auto& pegs) {
+            auto& levels = order->GetOrderType() == OrderType::PrimaryPeg ? pegs.primary_ : pegs.midpoint_;
+            auto& orders = levels.at(order->GetPegOffset());
+            orders.erase(iterator);
+            if (orders.empty())
+                levels.erase(order->GetPegOffset());
+        };
+        if (order->GetSide() == Side::Buy)
+            RemovePeg(buyPegs_);
+        else
+            RemovePeg(sellPegs_);
+        return order;
     }
-}  // Lock is released here
-
 
-// this version is to ensure thread safety
-void OrderBook::CancelOrderInternal(OrderId orderId) {
     // if the orderid does not even exist we dont run anything
     if (orders_.find(orderId) == orders_.end())
-        return;
+        return nullptr;
 
-    const auto [order, iterator] = orders_.at(orderId);
-    orders_.erase(orderId);
+    const auto [order, iterator, _] = orders_.at(orderId);
+    EraseEntry(orders_, orderId);
 
 
     // This is to ensure the order is removed from the orderbooks;
@@ -95,35 +156,183 @@ void OrderBook::CancelOrderInternal(OrderId orderId) {
         if (orders.empty()) 
             bids_.erase(price);
     }
+    return order;
+}
 
-    OnOrderCancelled(order);
+// this version is to ensure thread safety
+template <typename Traits>
+void BasicOrderBook<Traits>::CancelOrderInternal(OrderId orderId) {
+    auto order = UnlinkOrder(orderId);
+    if (!order)
+        return;
 
+    OnOrderCancelled(order);
+    UpdateGauges();
 }
 
+template <typename Traits>
+typename BasicOrderBook<Traits>::MassCancelResult BasicOrderBook<Traits>::MassCancel(const MassCancelFilter& filter) {
+    std::scoped_lock ordersLock{ordersMutex_};
+
+    const auto reference = CurrentPegReference();
+    auto Matches = [&](const OrderPointer& order) {
+        if (filter.side_ && order->GetSide() != *filter.side_)
+            return false;
+        if (!filter.minPrice_ && !filter.maxPrice_)
+            return true;
+
+        std::optional<Price> price = order->GetPrice();
+        if (order->IsStopOrder())
+            price = order->GetStopPrice();
+        else if (order->IsPegged())
+            price = PegPrice(order->GetOrderType(), order->GetSide(), order->GetPegOffset(), reference);
+
+        // A pegged order without a reference has no price, so it is outside every band
+        return price && (!filter.minPrice_ || *price >= *filter.minPrice_) && (!filter.maxPrice_ || *price <= *filter.maxPrice_);
+    };
+
+    // Pick the orders first, unlinking while walking the owner list would invalidate it
+    OrderPointers cancelled;
+    if (filter.owner_) {
+        if (auto owner = ownerOrders_.find(*filter.owner_); owner != ownerOrders_.end())
+            for (const auto& order : owner->second)
+                if (Matches(order))
+                    cancelled.push_back(order);
+    }
+    else {
+        for (const auto* index : {&orders_, &pegOrders_, &stopOrders_})
+            for (const auto& [_, entry] : *index)
+                if (Matches(entry.order_))
+                    cancelled.push_back(entry.order_);
+    }
 
+    // Level data changes once per level instead of once per order
+    std::map<Price, LevelData, std::greater<Price>> bidChanges;
+    std::map<Price, LevelData, std::less<Price>> askChanges;
+    for (const auto& order : cancelled) {
+        UnlinkOrder(order->GetOrderId());
+        Tracer::Record(TraceEventType::OrderCancelled, order->GetOrderId(), Tracer::ToTraceSide(order->GetSide()),
+            order->GetPrice(), order->GetRemainingQuantity());
+
+        if (order->IsPegged() || order->IsStopOrder())
+            continue;
+        if (marketData_)
+            marketData_->OrderDelete(order->GetOrderId());
+        auto& change = order->GetSide() == Side::Buy ? bidChanges[order->GetPrice()] : askChanges[order->GetPrice()];
+        change.quantity_ += order->GetRemainingQuantity();
+        change.count_ += 1;
+    }
+
+    MassCancelResult result;
+    result.cancelled_ = cancelled.size();
+    auto ApplyChanges = [this](const auto& changes, LevelDataMap& levelData, LevelInfos& updates) {
+        for (const auto& [price, change] : changes) {
+            auto data = levelData.find(price);
+            data->second.quantity_ -= change.quantity_;
+            data->second.count_ -= change.count_;
+            updates.push_back(LevelInfo{price, data->second.quantity_});
+
+            if (data->second.count_ == 0) {
+                levelData.erase(data);
+                Tracer::Record(TraceEventType::LevelErased, 0, TraceSide::None, price, 0);
+            }
+        }
+    };
+    ApplyChanges(bidChanges, bidData_, result.bids_);
+    ApplyChanges(askChanges, askData_, result.asks_);
+
+    EngineMetrics::Increment(metrics_.ordersCancelled_, cancelled.size());
+    UpdateGauges();
+    return result;
+}
 
-void OrderBook::OnOrderCancelled(OrderPointer order) {
+template <typename Traits>
+void BasicOrderBook<Traits>::OnOrderCancelled(OrderPointer order) {
     // When an order is cancelled, we need to remove exactly what's still in the order book. 
     // The remaining quantity represents the unfilled portion of the order that is still active in the book
     // We can only cancel whats remaining from the order. cant cancel what was already filled
-    UpdateLevelData(order->GetPrice(), order->GetRemainingQuantity(), LevelData::Action::Remove);
+    Tracer::Record(TraceEventType::OrderCancelled, order->GetOrderId(), Tracer::ToTraceSide(order->GetSide()),
+        order->GetPrice(), order->GetRemainingQuantity());
+    EngineMetrics::Increment(metrics_.ordersCancelled_);
+    // Pegged orders have no fixed price and pending stops are not in the book, neither is part of the level data
+    if (order->IsPegged() || order->IsStopOrder())
+        return;
+    UpdateLevelData(order->GetSide(), order->GetPrice(), order->GetRemainingQuantity(), LevelData::Action::Remove);
+    if (marketData_ && order.get() != incoming_)
+        marketData_->OrderDelete(order->GetOrderId());
 }
 
-void OrderBook::OnOrderAdded(OrderPointer order) {
-    UpdateLevelData(order->GetPrice(), order->GetInitialQuantity(), LevelData::Action::Add);
+template <typename Traits>
+void BasicOrderBook<Traits>::OnOrderAdded(OrderPointer order) {
+    // Only the visible quantity counts towards the level, an iceberg reserve stays hidden
+    Tracer::Record(TraceEventType::OrderAdded, order->GetOrderId(), Tracer::ToTraceSide(order->GetSide()),
+        order->GetPrice(), order->GetRemainingQuantity());
+    if (order->IsPegged())
+        return;
+    UpdateLevelData(order->GetSide(), order->GetPrice(), order->GetRemainingQuantity(), LevelData::Action::Add);
+    if (marketData_ && order.get() != incoming_)
+        marketData_->AddOrder(order->GetOrderId(), order->GetSide(), order->GetRemainingQuantity(), order->GetPrice());
 }
 
+template <typename Traits>
+void BasicOrderBook<Traits>::OnOrderReplenished(OrderPointer order) {
+    const auto quantity = order->Replenish();
+    Tracer::Record(TraceEventType::OrderReplenished, order->GetOrderId(), Tracer::ToTraceSide(order->GetSide()),
+        order->GetPrice(), quantity);
+    UpdateLevelData(order->GetSide(), order->GetPrice(), quantity, LevelData::Action::Replenish);
+    // The new tranche is a new order at the back of the level as far as the feed is concerned
+    if (marketData_ && order.get() != incoming_)
+        marketData_->AddOrder(order->GetOrderId(), order->GetSide(), quantity, order->GetPrice());
+}
 
-void OrderBook::OnOrderMatched(Price price, Quantity quantity, bool isFullyFilled) {
+
+template <typename Traits>
+void BasicOrderBook<Traits>::OnOrderMatched(const OrderPointer& order, Price price, Quantity quantity, bool traded) {
     // If the order was fully filled then we remove that count from our structure
     // Otherwise we dont touch the count property
-    UpdateLevelData(price, quantity, isFullyFilled ? LevelData::Action::Remove : LevelData::Action::Match);
+    const bool isFullyFilled = order->IsFilled();
+    Tracer::Record(TraceEventType::OrderMatched, 0, TraceSide::None, price, quantity, isFullyFilled ? 1 : 0);
+    UpdateLevelData(order->GetSide(), price, quantity, isFullyFilled ? LevelData::Action::Remove : LevelData::Action::Match);
 
+    if (!marketData_ || order.get() == incoming_)
+        return;
+    if (traded)
+        marketData_->OrderExecuted(order->GetOrderId(), quantity);
+    else if (isFullyFilled)
+        marketData_->OrderDelete(order->GetOrderId());
+    else
+        marketData_->OrderCancel(order->GetOrderId(), quantity);
 }
 
-void OrderBook::UpdateLevelData(Price price, Quantity quantity, LevelData::Action action) {
-    auto& data = data_[price];
-    
+template <typename Traits>
+void BasicOrderBook<Traits>::OnTrade(const Trade& trade, const OrderPointer& bid, const OrderPointer& ask) {
+    // The order that was in the book first is the resting one, the trade is at its price
+    const bool bidRests = bid->GetSequence() < ask->GetSequence();
+    const auto& resting = bidRests ? trade.getBidTrade() : trade.geAskTrade();
+    RecordExecutionPrice(resting.price_);
+    if (!marketData_ && !tradeTape_ && !bars_)
+        return;
+    if (marketData_)
+        marketData_->Trade(resting.orderId_, bidRests ? Side::Buy : Side::Sell, resting.quantity_, resting.price_);
+    if (!tradeTape_ && !bars_)
+        return;
+
+    const auto timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    if (tradeTape_)
+        tradeTape_->Record(timestamp, bidRests ? Side::Sell : Side::Buy, resting.price_, resting.quantity_);
+    if (bars_)
+        bars_->OnTrade(timestamp, resting.price_, resting.quantity_);
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::UpdateLevelData(Side side, Price price, Quantity quantity, typename LevelData::Action action) {
+    auto& levelData = side == Side::Buy ? bidData_ : askData_;
+    auto [dataIterator, created] = levelData.try_emplace(price);
+    auto& data = dataIterator->second;
+    if (created)
+        Tracer::Record(TraceEventType::LevelCreated, 0, TraceSide::None, price, 0);
+
     // If the action is to remove from our books, we reduce the number of orders on the book. same logic for add
     if (action == LevelData::Action::Remove) {
         data.count_ -= 1;
@@ -131,7 +340,7 @@ void OrderBook::UpdateLevelData(Price price, Quantity quantity, LevelData::Actio
         data.count_ += 1;
     }
 
-    // If we removed or matched, reduce the quantity by the amount we removed or matched by
+    // If we removed or matched, reduce the quantity by the amount we removed or matched by. Add and Replenish increase it
     if (action == LevelData::Action::Remove || action == LevelData::Action::Match) {
         data.quantity_ -= quantity;
     }
@@ -141,178 +350,544 @@ void OrderBook::UpdateLevelData(Price price, Quantity quantity, LevelData::Actio
     }
 
     // If there's no data at that price, remove it
-    if (data.count_ == 0)
-        data_.erase(price);
+    if (data.count_ == 0) {
+        levelData.erase(dataIterator);
+        Tracer::Record(TraceEventType::LevelErased, 0, TraceSide::None, price, 0);
+    }
 }
 
-bool OrderBook::CanFullyFill(Side side, Price price, Quantity quantity) const {
-    // If we can match, then when we call asks or bid . begin() we know that won't be undefined behavior
+template <typename Traits>
+void BasicOrderBook<Traits>::UpdateGauges() {
+    // Rough per-node sizes of the node based containers: payload plus the pointers the standard library keeps
+    constexpr std::size_t OrderBytes = sizeof(Order) + 2 * sizeof(void*);                   // Order + shared_ptr control block
+    constexpr std::size_t LevelNodeBytes = sizeof(OrderPointer) + 2 * sizeof(void*);        // std::list node
+    constexpr std::size_t IndexNodeBytes = sizeof(std::pair<const OrderId, OrderEntry>) + 2 * sizeof(void*);
+    constexpr std::size_t PriceNodeBytes = sizeof(std::pair<const Price, OrderPointers>) + 4 * sizeof(void*);
+    constexpr std::size_t DataNodeBytes = sizeof(std::pair<const Price, LevelData>) + 2 * sizeof(void*);
+
+    const auto orderCount = orders_.size();
+    const auto levelCount = bids_.size() + asks_.size();
+    const auto stopLevelCount = buyStops_.size() + sellStops_.size();
+    const auto pegLevelCount = buyPegs_.primary_.size() + buyPegs_.midpoint_.size()
+        + sellPegs_.primary_.size() + sellPegs_.midpoint_.size();
+    const auto memoryBytes = (orderCount + stopOrders_.size() + pegOrders_.size()) * (OrderBytes + LevelNodeBytes + IndexNodeBytes)
+        + (levelCount + stopLevelCount + pegLevelCount) * PriceNodeBytes
+        + (bidData_.size() + askData_.size()) * DataNodeBytes
+        + (detail::BucketCount(orders_) + detail::BucketCount(stopOrders_) + detail::BucketCount(pegOrders_)
+            + bidData_.bucket_count() + askData_.bucket_count()) * sizeof(void*);
+
+    EngineMetrics::Set(metrics_.restingOrders_, orderCount + pegOrders_.size());
+    EngineMetrics::Set(metrics_.peggedOrders_, pegOrders_.size());
+    EngineMetrics::Set(metrics_.bidLevels_, bids_.size());
+    EngineMetrics::Set(metrics_.askLevels_, asks_.size());
+    EngineMetrics::Set(metrics_.pendingStopOrders_, stopOrders_.size());
+    EngineMetrics::Set(metrics_.memoryBytes_, memoryBytes);
+}
+
+template <typename Traits>
+bool BasicOrderBook<Traits>::CanFullyFill(Side side, Price price, Quantity quantity, OwnerId owner, SelfTradePrevention selfTradePrevention) const {
     if (!CanMatch(side, price))
         return false;
 
-    // The best price we can get for FOK
-    std::optional<Price> threshold;
+    // Walked order by order in the priority they would trade in: a sweep also takes the reserve of icebergs,
+    // which the level data leaves out, and self trade prevention acts on single orders. The walk ends as soon
+    // as quantity is covered
+    const auto reference = CurrentPegReference();
+    const auto opposite = side == Side::Buy ? Side::Sell : Side::Buy;
+    auto Within = [&](Price sourcePrice) { return side == Side::Buy ? sourcePrice <= price : sourcePrice >= price; };
+    auto Before = [&](Price left, Price right) { return side == Side::Buy ? left < right : left > right; };
+
+    enum class Outcome { Filled, Stopped, More };
+    auto Take = [&](const OrderPointers& orders) {
+        for (const auto& order : orders) {
+            // Own orders never trade with it, and unless it cancels the oldest the order itself goes on meeting one
+            if (owner != Constants::NoOwner && order->GetOwner() == owner) {
+                if (selfTradePrevention != SelfTradePrevention::CancelOldest)
+                    return Outcome::Stopped;
+                continue;
+            }
+            if (quantity <= order->GetOpenQuantity())
+                return Outcome::Filled;
+            quantity -= order->GetOpenQuantity();
+        }
+        return Outcome::More;
+    };
+
+    auto Walk = [&](const auto& levels, const auto& pegs) {
+        // Pegged groups at the price the sweep would give them. There are few, so they are sorted here; at one
+        // price limit levels trade first, then primary pegs, then midpoint pegs
+        std::vector<std::pair<Price, const OrderPointers*>> pegGroups;
+        auto AddPegs = [&](OrderType type, const auto& groups) {
+            for (const auto& [offset, orders] : groups)
+                if (const auto pegPrice = PegPrice(type, opposite, offset, reference); pegPrice && Within(*pegPrice))
+                    pegGroups.emplace_back(*pegPrice, &orders);
+        };
+        AddPegs(OrderType::PrimaryPeg, pegs.primary_);
+        AddPegs(OrderType::MidpointPeg, pegs.midpoint_);
+        std::stable_sort(pegGroups.begin(), pegGroups.end(), [&](const auto& left, const auto& right) { return Before(left.first, right.first); });
+
+        auto peg = pegGroups.begin();
+        for (const auto& [levelPrice, orders] : levels) {
+            if (!Within(levelPrice))
+                break;
+            for (; peg != pegGroups.end() && Before(peg->first, levelPrice); ++peg)
+                if (const auto outcome = Take(*peg->second); outcome != Outcome::More)
+                    return outcome == Outcome::Filled;
+            if (const auto outcome = Take(orders); outcome != Outcome::More)
+                return outcome == Outcome::Filled;
+        }
+        for (; peg != pegGroups.end(); ++peg)
+            if (const auto outcome = Take(*peg->second); outcome != Outcome::More)
+                return outcome == Outcome::Filled;
+        return false;
+    };
+
+    return side == Side::Buy ? Walk(asks_, sellPegs_) : Walk(bids_, buyPegs_);
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::PegReference BasicOrderBook<Traits>::CurrentPegReference() const {
+    PegReference reference;
+    if (!bids_.empty())
+        reference.bid_ = bids_.begin()->first;
+    if (!asks_.empty())
+        reference.ask_ = asks_.begin()->first;
+    return reference;
+}
 
-    if (side== Side::Buy) {
-        const auto [askPrice, _] = *asks_.begin();
-        threshold = askPrice;
+template <typename Traits>
+std::optional<typename BasicOrderBook<Traits>::Price> BasicOrderBook<Traits>::PegPrice(OrderType type, Side side, Price offset, const PegReference& reference) {
+    if (type == OrderType::PrimaryPeg) {
+        const auto& primary = side == Side::Buy ? reference.bid_ : reference.ask_;
+        if (!primary)
+            return std::nullopt;
+        return *primary + offset;
     }
 
+    if (!reference.bid_ || !reference.ask_)
+        return std::nullopt;
+
+    // An odd spread has no whole tick midpoint: buys round down and sells round up, never past the midpoint
+    const auto sum = *reference.bid_ + *reference.ask_;
+    const auto midpoint = side == Side::Buy ? sum / 2 : (sum + 1) / 2;
+    return midpoint + offset;
+}
+
+template <typename Traits>
+std::optional<typename BasicOrderBook<Traits>::MatchSource> BasicOrderBook<Traits>::BestSource(Side side, const PegReference& reference) const {
+    std::optional<MatchSource> best;
+
+    // Strictly better only, so at equal prices the source considered first keeps priority
+    auto Consider = [&](typename MatchSource::Kind kind, std::optional<Price> price) {
+        if (price && (!best || (side == Side::Buy ? *price > best->price_ : *price < best->price_)))
+            best = MatchSource{kind, *price};
+    };
+    auto ConsiderPegs = [&](const auto& pegs) {
+        if (!pegs.primary_.empty())
+            Consider(MatchSource::Kind::PrimaryPeg, PegPrice(OrderType::PrimaryPeg, side, pegs.primary_.begin()->first, reference));
+        if (!pegs.midpoint_.empty())
+            Consider(MatchSource::Kind::MidpointPeg, PegPrice(OrderType::MidpointPeg, side, pegs.midpoint_.begin()->first, reference));
+    };
+
+    if (side == Side::Buy) {
+        if (!bids_.empty())
+            Consider(MatchSource::Kind::Limit, bids_.begin()->first);
+        ConsiderPegs(buyPegs_);
+    }
     else {
-        const auto [bidPrice, _] = *bids_.begin();
-        threshold = bidPrice;
+        if (!asks_.empty())
+            Consider(MatchSource::Kind::Limit, asks_.begin()->first);
+        ConsiderPegs(sellPegs_);
     }
+    return best;
+}
 
-    // Lets say the worst ask is at 110 and the best ask is at 90. The FOK order would be 
-    // somewhere in between (100). We need to find how many orders exist between best ask and FOK price
-    for (const auto& [levelPrice, levelData]: data_) {
-        // Filtering for at or below FOK price. We are filtering out the ones that we don't need for readability
-        if (threshold.has_value() && 
-            (side == Side::Buy && threshold.value() > levelPrice) || // threshold 100 and level price is 105. thats false. if the price is more than our threshold we just skip this whole level price
-            (side == Side::Sell && threshold.value() < levelPrice))
-            continue;
-        
+template <typename Traits>
+bool BasicOrderBook<Traits>::CanMatch(Side side, Price price) const {
+    // Pegged orders on the other side count at the price they have right now
+    const auto best = BestSource(side == Side::Buy ? Side::Sell : Side::Buy, CurrentPegReference());
+    if (!best)
+        return false;
+    return side == Side::Buy ? price >= best->price_ : price <= best->price_;
+}
 
-        if ((side == Side::Buy && levelPrice > price) || // if the level price is more than the price we're willing to pay, go to next level price.
-            (side == Side::Sell && levelPrice < price))
-                continue;
+template <typename Traits>
+void BasicOrderBook<Traits>::SettleMatchedOrder(const MatchSource& source, OrderPointers& orders, typename OrderPointers::iterator position, Quantity quantity,
+    bool traded) {
+    const auto order = *position;
+    // Only limit levels have level data
+    const bool limitLevel = source.kind_ == MatchSource::Kind::Limit;
+    if (!limitLevel)
+        Tracer::Record(TraceEventType::OrderMatched, 0, TraceSide::None, source.price_, quantity, order->IsFilled() ? 1 : 0);
+    else
+        OnOrderMatched(order, source.price_, quantity, traded);
+
+    // Filled orders leave the book. An iceberg whose tranche ran out reloads from its reserve and
+    // goes to the back of its level: splice keeps the iterator stored in orders_ valid
+    if (order->IsFilled()) {
+        orders.erase(position);
+        // A swept in order was never indexed
+        if (source.kind_ != MatchSource::Kind::Incoming)
+            EraseEntry(limitLevel ? orders_ : pegOrders_, order->GetOrderId());
+    }
+    else if (order->NeedsReplenish()) {
+        orders.splice(orders.end(), orders, position);
+        OnOrderReplenished(order);
+    }
+}
 
-        // If quantity gets to a number that is less than the quantity we want to match at, then we know we can fully fill
-        
-        if (quantity <= levelData.quantity_)
-            return true;
+template <typename Traits>
+void BasicOrderBook<Traits>::CancelFrontOrder(const MatchSource& source, OrderPointers& orders) {
+    auto order = orders.front();
+    orders.pop_front();
+    // A swept in order is not in the book, taking it out of its list drops it
+    if (source.kind_ == MatchSource::Kind::Incoming)
+        return;
+    EraseEntry(source.kind_ == MatchSource::Kind::Limit ? orders_ : pegOrders_, order->GetOrderId());
+    OnOrderCancelled(order);
+}
 
-        // If we have a desired price, subtract our quantity from the quantity at that level
-        quantity -= levelData.quantity_;
+template <typename Traits>
+bool BasicOrderBook<Traits>::PreventSelfTrade(const MatchSource& bidSource, OrderPointers& bids, const MatchSource& askSource, OrderPointers& asks) {
+    auto bid = bids.front();
+    auto ask = asks.front();
+    if (bid->GetOwner() == Constants::NoOwner)
+        return false;
 
+    EngineMetrics::Increment(metrics_.selfTradesPrevented_);
+    const bool bidIsNewest = bid->GetSequence() > ask->GetSequence();
+
+    switch ((bidIsNewest ? bid : ask)->GetSelfTradePrevention()) {
+        case SelfTradePrevention::CancelNewest:
+            bidIsNewest ? CancelFrontOrder(bidSource, bids) : CancelFrontOrder(askSource, asks);
+            break;
+        case SelfTradePrevention::CancelOldest:
+            bidIsNewest ? CancelFrontOrder(askSource, asks) : CancelFrontOrder(bidSource, bids);
+            break;
+        case SelfTradePrevention::CancelBoth:
+            CancelFrontOrder(bidSource, bids);
+            CancelFrontOrder(askSource, asks);
+            break;
+        case SelfTradePrevention::Decrement: {
+            // Taken out like a fill, only no trade is reported. An iceberg reloads and keeps decrementing
+            const auto quantity = std::min(bid->GetRemainingQuantity(), ask->GetRemainingQuantity());
+            bid->Fill(quantity);
+            ask->Fill(quantity);
+            SettleMatchedOrder(bidSource, bids, bids.begin(), quantity, false);
+            SettleMatchedOrder(askSource, asks, asks.begin(), quantity, false);
+            break;
+        }
+    }
+    return true;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::MatchLevels(const MatchSource& bidSource, OrderPointers& bids, const MatchSource& askSource, OrderPointers& asks,
+    Price bidPrice, Price askPrice, Trades& trades, std::optional<Side> rationedSide) {
+    if constexpr (MatchingPolicy::ProRata) {
+        MatchLevelsProRata(bidSource, bids, askSource, asks, bidPrice, askPrice, trades, rationedSide);
+        return;
     }
 
+    while (bids.size() && asks.size()) {
+        auto bid = bids.front();
+        auto ask = asks.front();
 
-    return false;
-    
-}
+        // The owners are on orders already loaded, so without a self trade this is one comparison
+        if (bid->GetOwner() == ask->GetOwner() && PreventSelfTrade(bidSource, bids, askSource, asks))
+            continue;
 
-bool OrderBook::CanMatch(Side side, Price price) const {
-    if (side == Side::Buy) {
-        if (asks_.empty()) return false;
-        const auto& bestAsk = asks_.begin()->first;
-        return price >= bestAsk;
+        Quantity quantity = std::min(bid->GetRemainingQuantity(), ask->GetRemainingQuantity());
+
+        bid->Fill(quantity);
+        ask->Fill(quantity);
+
+        trades.push_back(Trade{
+            TradeInfo{bid->GetOrderId(), bidPrice, quantity}, 
+            TradeInfo{ask->GetOrderId(), askPrice, quantity}
+        });
+        OnTrade(trades.back(), bid, ask);
+
+        SettleMatchedOrder(bidSource, bids, bids.begin(), quantity, true);
+        SettleMatchedOrder(askSource, asks, asks.begin(), quantity, true);
     }
-    else {
-        if (bids_.empty()) return false;
-        const auto& bestBid = bids_.begin()->first;
-        return price <= bestBid;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::MatchLevelsProRata(const MatchSource& bidSource, OrderPointers& bids, const MatchSource& askSource, OrderPointers& asks,
+    Price bidPrice, Price askPrice, Trades& trades, std::optional<Side> rationedSide) {
+    // Only instantiated with a body for pro-rata policies, FIFO never calls it
+    if constexpr (MatchingPolicy::ProRata) {
+        const bool bidIsAggressor = rationedSide ? *rationedSide == Side::Sell : bids.front()->GetSequence() > asks.front()->GetSequence();
+        const auto& aggressorSource = bidIsAggressor ? bidSource : askSource;
+        const auto& restingSource = bidIsAggressor ? askSource : bidSource;
+        auto& aggressors = bidIsAggressor ? bids : asks;
+        auto& resting = bidIsAggressor ? asks : bids;
+
+        while (aggressors.size() && resting.size()) {
+            auto aggressor = aggressors.front();
+
+            // Resting orders of the aggressor's owner take no share. If nothing else is left the prevention
+            // mode settles the front pair as in FIFO matching
+            proRataPositions_.clear();
+            proRataResting_.clear();
+            for (auto position = resting.begin(); position != resting.end(); ++position) {
+                if ((*position)->GetOwner() == aggressor->GetOwner() && aggressor->GetOwner() != Constants::NoOwner)
+                    continue;
+                proRataPositions_.push_back(position);
+                proRataResting_.push_back((*position)->GetRemainingQuantity());
+            }
+            if (proRataPositions_.empty()) {
+                PreventSelfTrade(bidSource, bids, askSource, asks);
+                continue;
+            }
+
+            proRataAllocations_.resize(proRataPositions_.size());
+            MatchingPolicy::Allocate(aggressor->GetRemainingQuantity(), proRataResting_.data(), proRataPositions_.size(),
+                proRataAllocations_.data());
+
+            // Positions stay valid while other orders of the level are erased or moved to its back
+            Quantity filled = 0;
+            for (std::size_t i = 0; i < proRataPositions_.size(); ++i) {
+                const auto quantity = proRataAllocations_[i];
+                if (quantity == 0)
+                    continue;
+
+                auto order = *proRataPositions_[i];
+                order->Fill(quantity);
+                aggressor->Fill(quantity);
+                filled += quantity;
+
+                const auto& bid = bidIsAggressor ? aggressor : order;
+                const auto& ask = bidIsAggressor ? order : aggressor;
+                trades.push_back(Trade{
+                    TradeInfo{bid->GetOrderId(), bidPrice, quantity},
+                    TradeInfo{ask->GetOrderId(), askPrice, quantity}
+                });
+                OnTrade(trades.back(), bid, ask);
+                SettleMatchedOrder(restingSource, resting, proRataPositions_[i], quantity, true);
+            }
+            // One execution for the whole pass, it carries the match number of the last trade
+            SettleMatchedOrder(aggressorSource, aggressors, aggressors.begin(), filled, true);
+        }
     }
 }
 
-Trades OrderBook::MatchOrders() {
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::MatchOrders(const PegReference& reference) {
     Trades trades;
     trades.reserve(orders_.size());
 
+    auto FrontLevel = [](auto& levels) -> OrderPointers& { return levels.begin()->second; };
+    auto EraseFrontLevel = [](auto& levels) { levels.erase(levels.begin()); };
+
     while (true) {
-        if (bids_.empty() || asks_.empty()) {
+        // Pegged prices are fixed by reference for the whole call, so the best source of a side can only
+        // change once its orders are used up
+        const auto bidSource = BestSource(Side::Buy, reference);
+        const auto askSource = BestSource(Side::Sell, reference);
+
+        if (!bidSource || !askSource || bidSource->price_ < askSource->price_) {
             break;
         }
-        
-        const auto& bidPrice = bids_.begin()->first;
-        auto& bids = bids_.begin()->second;
 
-        const auto& askPrice = asks_.begin()->first;
-        auto& asks = asks_.begin()->second;
+        auto& bids = VisitSourceLevels(Side::Buy, bidSource->kind_, FrontLevel);
+        auto& asks = VisitSourceLevels(Side::Sell, askSource->kind_, FrontLevel);
+        MatchLevels(*bidSource, bids, *askSource, asks, bidSource->price_, askSource->price_, trades);
 
-        if (bidPrice < askPrice) {
-            break;
-        }
+        // Erase emptied levels only after the loop, bids and asks refer to them
+        if (bids.empty()) VisitSourceLevels(Side::Buy, bidSource->kind_, EraseFrontLevel);
+        if (asks.empty()) VisitSourceLevels(Side::Sell, askSource->kind_, EraseFrontLevel);
+    }
 
-        while (bids.size() && asks.size()) {
-            auto bid = bids.front();
-            auto ask = asks.front();
+    EngineMetrics::Increment(metrics_.trades_, trades.size());
+    return trades;
+}
 
-            Quantity quantity = std::min(bid->GetRemainingQuantity(), ask->GetRemainingQuantity());
 
-            bid->Fill(quantity);
-            ask->Fill(quantity);
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::AddOrder(OrderPointer order) {
+    if (orders_.find(order->GetOrderId()) != orders_.end() || stopOrders_.find(order->GetOrderId()) != stopOrders_.end()
+        || pegOrders_.find(order->GetOrderId()) != pegOrders_.end())
+        return { };
 
-            trades.push_back(Trade{
-                TradeInfo{bid->GetOrderId(), bid->GetPrice(), quantity}, 
-                TradeInfo{ask->GetOrderId(), ask->GetPrice(), quantity}
-            });
-
-            // Store order IDs before modifying containers
-            auto bidId = bid->GetOrderId();
-            auto askId = ask->GetOrderId();
-            auto bidPriceCopy = bid->GetPrice();
-            auto askPriceCopy = ask->GetPrice();
-            bool bidFilled = bid->IsFilled();
-            bool askFilled = ask->IsFilled();
-
-            if (bidFilled) {
-                bids.pop_front();
-                orders_.erase(bidId);
-            }
+    Trades trades;
+    if (order->IsStopOrder())
+        AddStopOrder(order);
+    else if (order->IsPegged())
+        trades = AddPeggedOrder(order);
+    else
+        trades = AddOrderInternal(order);
+
+    // Also covers a stop order whose stop price was already reached when it arrived
+    ActivateStopOrders(trades);
+    UpdateGauges();
+    return trades;
+}
 
-            if (askFilled) {
-                asks.pop_front();
-                orders_.erase(askId);
-            }
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::AddPeggedOrder(OrderPointer order) {
+    EngineMetrics::Increment(metrics_.ordersAdded_[EngineMetrics::Index(order->GetOrderType())]);
 
-            if (bids.empty()) bids_.erase(bidPrice);
-            if (asks.empty()) asks_.erase(askPrice);
+    typename OrderPointers::iterator iterator;
+    auto Insert = [&](auto& pegs) {
+        auto& levels = order->GetOrderType() == OrderType::PrimaryPeg ? pegs.primary_ : pegs.midpoint_;
+        auto& orders = levels[order->GetPegOffset()];
+        orders.push_back(order);
+        iterator = std::prev(orders.end());
+    };
+    if (order->GetSide() == Side::Buy)
+        Insert(buyPegs_);
+    else
+        Insert(sellPegs_);
 
-            OnOrderMatched(bidPriceCopy, quantity, bidFilled);
-            OnOrderMatched(askPriceCopy, quantity, askFilled);
-        }
+    pegOrders_.insert({order->GetOrderId(), OrderEntry{order, iterator, LinkOwner(order)}});
+    order->SetSequence(++sequence_);
+    OnOrderAdded(order);
+    // Pegged orders sit out the auction, they are priced and matched again once it uncrosses
+    if (session_ == TradingSession::Auction)
+        return {};
+
+    // A pegged order never crosses the limit side it is pegged to, but midpoint pegs on both sides meet
+    // at an even spread
+    return MatchOrders(CurrentPegReference());
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::RecordExecutionPrice(Price price) {
+    if (!lastTradePrice_) {
+        tradedLow_ = price;
+        tradedHigh_ = price;
     }
+    tradedLow_ = std::min(tradedLow_, price);
+    tradedHigh_ = std::max(tradedHigh_, price);
+    lastTradePrice_ = price;
+}
 
-    if (!bids_.empty()) {
-        const auto& bidPrice = bids_.begin()->first;
-        auto& bids = bids_.begin()->second;
+template <typename Traits>
+void BasicOrderBook<Traits>::AddStopOrder(OrderPointer order) {
+    EngineMetrics::Increment(metrics_.ordersAdded_[EngineMetrics::Index(order->GetOrderType())]);
 
-        auto order = bids.front();
-        if (order && order->GetOrderType() == OrderType::FillAndKill)
-            CancelOrder(order->GetOrderId());
+    typename OrderPointers::iterator iterator;
+    if (order->GetSide() == Side::Buy) {
+        auto& orders = buyStops_[order->GetStopPrice()];
+        orders.push_back(order);
+        iterator = std::prev(orders.end());
+    }
+    else {
+        auto& orders = sellStops_[order->GetStopPrice()];
+        orders.push_back(order);
+        iterator = std::prev(orders.end());
     }
-    
-    if (!asks_.empty()) {
-        const auto& askPrice = asks_.begin()->first;
-        auto& asks = asks_.begin()->second;
 
-        auto order = asks.front();
-        if (order && order->GetOrderType() == OrderType::FillAndKill)
-            CancelOrder(order->GetOrderId());
+    stopOrders_.insert({order->GetOrderId(), OrderEntry{order, iterator, LinkOwner(order)}});
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::OrderPointer BasicOrderBook<Traits>::PopTriggeredStopOrder() {
+    // A triggered stop becomes a market order, which an auction rejects. They stay parked until Uncross
+    if (!lastTradePrice_ || session_ == TradingSession::Auction)
+        return nullptr;
+
+    // Only the front level of each side can have been crossed, everything behind it is further away
+    auto PopFront = [this](auto& stops) {
+        auto level = stops.begin();
+        auto order = level->second.front();
+        level->second.pop_front();
+        if (level->second.empty())
+            stops.erase(level);
+        EraseEntry(stopOrders_, order->GetOrderId());
+        return order;
+    };
+
+    if (!buyStops_.empty() && buyStops_.begin()->first <= tradedHigh_)
+        return PopFront(buyStops_);
+    if (!sellStops_.empty() && sellStops_.begin()->first >= tradedLow_)
+        return PopFront(sellStops_);
+    return nullptr;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::ActivateStopOrders(Trades& trades) {
+    // Triggered orders run in stop price order, then arrival order within a stop price. Their own trades move
+    // the last price and may trigger further stops, which the next iteration picks up
+    while (auto order = PopTriggeredStopOrder()) {
+        EngineMetrics::Increment(metrics_.stopsTriggered_);
+        Tracer::Record(TraceEventType::StopTriggered, order->GetOrderId(), Tracer::ToTraceSide(order->GetSide()),
+            order->GetStopPrice(), order->GetRemainingQuantity());
+
+        order->Trigger();
+        auto triggeredTrades = AddOrderInternal(order);
+        trades.insert(trades.end(), triggeredTrades.begin(), triggeredTrades.end());
     }
 
-    return trades;
+    // Prints already checked trigger nothing more, stops that arrive later are compared against the last price
+    if (lastTradePrice_) {
+        tradedLow_ = *lastTradePrice_;
+        tradedHigh_ = *lastTradePrice_;
+    }
 }
 
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::AddOrderInternal(OrderPointer order) {
+    // Nothing executes until the uncross, so orders that only live for an immediate execution have no place in an auction
+    if (session_ == TradingSession::Auction && (order->GetOrderType() == OrderType::Market
+        || order->GetOrderType() == OrderType::FillAndKill || order->GetOrderType() == OrderType::FillOrKill)) {
+        EngineMetrics::Increment(metrics_.ordersRejected_[EngineMetrics::Index(order->GetOrderType())]);
+        return {};
+    }
 
-Trades OrderBook::AddOrder(OrderPointer order) {
-    if (orders_.find(order->GetOrderId()) != orders_.end())
-        return { };
+    if (order->GetOrderType() == OrderType::Market)
+        return AddMarketOrder(order);
 
-    if (order->GetOrderType() == OrderType::Market) {
-        // If we want to buy and there are sellers, buy at the worst ask price (best buy price)
-        if (order->GetSide() == Side::Buy && !asks_.empty()) {
-            order->ToGoodTillCancel(asks_.rbegin()->first);
-        }
-        // If we want to sell and there are buyers, sell at the worst bid price (best sell price)
-        else if (order->GetSide() == Side::Sell && !bids_.empty()) {
-            order->ToGoodTillCancel(bids_.rbegin()->first);
-        }
-        else 
+    // Post only orders must add liquidity. Decided from the best opposite price before anything is inserted
+    if (order->GetPostOnly() != PostOnly::Off && CanMatch(order->GetSide(), order->GetPrice())) {
+        if (order->GetPostOnly() == PostOnly::Reject) {
+            EngineMetrics::Increment(metrics_.postOnlyRejected_);
             return {};
+        }
+
+        // One tick behind the best opposite price is the most aggressive price that still rests
+        const auto opposite = BestSource(order->GetSide() == Side::Buy ? Side::Sell : Side::Buy, CurrentPegReference());
+        order->Slide(order->GetSide() == Side::Buy ? opposite->price_ - Constants::TickSize : opposite->price_ + Constants::TickSize);
+        EngineMetrics::Increment(metrics_.postOnlySlid_);
     }
 
     if (order->GetOrderType() == OrderType::FillAndKill && !CanMatch(
-        order->GetSide(), order->GetPrice()))
+        order->GetSide(), order->GetPrice())) {
+        EngineMetrics::Increment(metrics_.ordersRejected_[EngineMetrics::Index(OrderType::FillAndKill)]);
         return { };
+    }
 
     // If the order is FOK and we can't fully fill, we do nothing
-    if (order->GetOrderType() == OrderType::FillOrKill && !CanFullyFill(order->GetSide(), order->GetPrice(), order->GetInitialQuantity()))
+    if (order->GetOrderType() == OrderType::FillOrKill && !CanFullyFill(order->GetSide(), order->GetPrice(), order->GetInitialQuantity(),
+        order->GetOwner(), order->GetSelfTradePrevention())) {
+        EngineMetrics::Increment(metrics_.ordersRejected_[EngineMetrics::Index(OrderType::FillOrKill)]);
+        return {};
+    }
+    // Neither kind ever rests: the order is matched straight against the opposite side up to its limit price
+    // and the rest is dropped, so it costs no level or index insertion
+    if (order->GetOrderType() == OrderType::FillAndKill || order->GetOrderType() == OrderType::FillOrKill) {
+        EngineMetrics::Increment(metrics_.ordersAdded_[EngineMetrics::Index(order->GetOrderType())]);
+        auto trades = SweepOrder(order, CurrentPegReference(), order->GetPrice());
+        MatchRepricedPegs(trades);
+        return trades;
+    }
+
+    // A bounded level store, such as a ladder, has no level for prices outside its range
+    if (!detail::StoreHolds<LevelStore<std::less<Price>>>(order->GetPrice())) {
+        EngineMetrics::Increment(metrics_.ordersRejected_[EngineMetrics::Index(order->GetOrderType())]);
         return {};
+    }
+
     // Otherwise, we fill the order using any other logic we have used
+    EngineMetrics::Increment(metrics_.ordersAdded_[EngineMetrics::Index(order->GetOrderType())]);
 
-    OrderPointers::iterator iterator;
+    // Pegged orders keep the price they had when this order arrived. Repricing them against the order itself
+    // would move a midpoint away from an incoming order that is inside the spread before it could trade
+    const auto reference = CurrentPegReference();
+
+    typename OrderPointers::iterator iterator;
 
     if (order->GetSide() == Side::Buy) {
         auto& orders = bids_[order->GetPrice()];
@@ -325,47 +900,401 @@ Trades OrderBook::AddOrder(OrderPointer order) {
         iterator = std::prev(orders.end());
     }
 
-    orders_.insert({order->GetOrderId(), OrderEntry{order, iterator}});
+    orders_.insert({order->GetOrderId(), OrderEntry{order, iterator, LinkOwner(order)}});
+    order->SetSequence(++sequence_);
 
+    // Nothing matches in an auction, so the order is published as it rests
+    if (session_ == TradingSession::Auction) {
+        OnOrderAdded(order);
+        return {};
+    }
+
+    incoming_ = order.get();
     OnOrderAdded(order);
-    return MatchOrders();
+    auto trades = MatchOrders(reference);
+    MatchRepricedPegs(trades);
+    incoming_ = nullptr;
+
+    // As on an exchange feed the order only shows up once it rests, so a feed of this book never crosses
+    if (marketData_ && orders_.find(order->GetOrderId()) != orders_.end())
+        marketData_->AddOrder(order->GetOrderId(), order->GetSide(), order->GetRemainingQuantity(), order->GetPrice());
+    return trades;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::MatchRepricedPegs(Trades& trades) {
+    // Crosses that a cancel opens up the same way are picked up by the next order that arrives
+    if (pegOrders_.empty())
+        return;
+
+    auto pegTrades = MatchOrders(CurrentPegReference());
+    trades.insert(trades.end(), pegTrades.begin(), pegTrades.end());
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::AddMarketOrder(OrderPointer order) {
+    const auto reference = CurrentPegReference();
+    const auto best = BestSource(order->GetSide() == Side::Buy ? Side::Sell : Side::Buy, reference);
+    if (!best) {
+        EngineMetrics::Increment(metrics_.ordersRejected_[EngineMetrics::Index(OrderType::Market)]);
+        return {};
+    }
+    EngineMetrics::Increment(metrics_.ordersAdded_[EngineMetrics::Index(OrderType::Market)]);
+
+    std::optional<Price> limit;
+    if (marketProtection_)
+        limit = order->GetSide() == Side::Buy ? best->price_ + *marketProtection_ : best->price_ - *marketProtection_;
+
+    auto trades = SweepOrder(order, reference, limit);
+    MatchRepricedPegs(trades);
+    return trades;
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::SweepOrder(OrderPointer order, const PegReference& reference, std::optional<Price> limit) {
+    Trades trades;
+    const auto side = order->GetSide();
+    const auto opposite = side == Side::Buy ? Side::Sell : Side::Buy;
+
+    auto FrontLevel = [](auto& levels) -> OrderPointers& { return levels.begin()->second; };
+    auto EraseFrontLevel = [](auto& levels) { levels.erase(levels.begin()); };
+
+    // A one order list lets the incoming order go through the same level matching as resting ones.
+    // It is the newest order for self-trade prevention and pro-rata
+    OrderPointers incoming { order };
+    order->SetSequence(++sequence_);
+
+    while (!incoming.empty()) {
+        const auto source = BestSource(opposite, reference);
+        if (!source || (limit && (side == Side::Buy ? source->price_ > *limit : source->price_ < *limit)))
+            break;
+
+        // A market order reports the price it traded at, a limit order its own price as it would from the book
+        const MatchSource incomingSource { MatchSource::Kind::Incoming,
+            order->GetOrderType() == OrderType::Market ? source->price_ : order->GetPrice() };
+        auto& resting = VisitSourceLevels(opposite, source->kind_, FrontLevel);
+        if (side == Side::Buy)
+            MatchLevels(incomingSource, incoming, *source, resting, incomingSource.price_, source->price_, trades);
+        else
+            MatchLevels(*source, resting, incomingSource, incoming, source->price_, incomingSource.price_, trades);
+
+        if (resting.empty())
+            VisitSourceLevels(opposite, source->kind_, EraseFrontLevel);
+    }
+
+    EngineMetrics::Increment(metrics_.trades_, trades.size());
+    return trades;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::AmendOrder(const OrderPointer& order, Quantity quantity) {
+    std::scoped_lock ordersLock{ordersMutex_};
+
+    // Only the level quantity changes, the order keeps its place in the level list
+    const auto visibleReduction = order->ReduceQuantity(quantity);
+    if (visibleReduction > 0) {
+        UpdateLevelData(order->GetSide(), order->GetPrice(), visibleReduction, LevelData::Action::Match);
+        if (marketData_)
+            marketData_->OrderCancel(order->GetOrderId(), visibleReduction);
+    }
+
+    EngineMetrics::Increment(metrics_.ordersAmended_);
+    Tracer::Record(TraceEventType::OrderAmended, order->GetOrderId(), Tracer::ToTraceSide(order->GetSide()),
+        order->GetPrice(), order->GetOpenQuantity());
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::SetMarketDataEncoder(ItchEncoder* encoder) {
+    std::scoped_lock ordersLock{ordersMutex_};
+    marketData_ = encoder;
 }
 
-void OrderBook::CancelOrder(OrderId orderId) {
+template <typename Traits>
+void BasicOrderBook<Traits>::SetTradeTape(TradeTape* tape) {
+    std::scoped_lock ordersLock{ordersMutex_};
+    tradeTape_ = tape;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::SetBarAggregator(BarAggregator* bars) {
+    std::scoped_lock ordersLock{ordersMutex_};
+    bars_ = bars;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::BeginAuction() {
+    session_ = TradingSession::Auction;
+}
+
+template <typename Traits>
+std::optional<typename BasicOrderBook<Traits>::AuctionEquilibrium> BasicOrderBook<Traits>::GetAuctionEquilibrium() const {
+    if (bids_.empty() || asks_.empty() || bids_.begin()->first < asks_.begin()->first)
+        return std::nullopt;
+
+    // Only prices between the lowest ask and the highest bid can execute anything
+    const auto low = asks_.begin()->first;
+    const auto high = bids_.begin()->first;
+    auto OpenQuantity = [](const OrderPointers& orders) {
+        std::uint64_t quantity = 0;
+        for (const auto& order : orders)
+            quantity += order->GetOpenQuantity();
+        return quantity;
+    };
+
+    // One entry per price that has a bid or an ask level in the range, ascending
+    std::vector<Price> prices;
+    std::vector<std::uint64_t> bidQuantities;
+    std::vector<std::uint64_t> askQuantities;
+    std::vector<std::pair<Price, std::uint64_t>> bidLevels;
+    for (auto level = bids_.begin(); level != bids_.end() && level->first >= low; ++level)
+        bidLevels.emplace_back(level->first, OpenQuantity(level->second));
+
+    auto bid = bidLevels.rbegin();
+    auto ask = asks_.begin();
+    while (bid != bidLevels.rend() || (ask != asks_.end() && ask->first <= high)) {
+        const bool hasAsk = ask != asks_.end() && ask->first <= high;
+        const auto price = bid == bidLevels.rend() ? ask->first : !hasAsk ? bid->first : std::min(bid->first, ask->first);
+        prices.push_back(price);
+        bidQuantities.push_back(bid != bidLevels.rend() && bid->first == price ? (bid++)->second : 0);
+        askQuantities.push_back(hasAsk && ask->first == price ? OpenQuantity((ask++)->second) : 0);
+    }
+
+    // Turn them into cumulative arrays: bids willing to pay at least prices[i], asks willing to sell at most prices[i]
+    for (std::size_t i = 1; i < prices.size(); ++i)
+        askQuantities[i] += askQuantities[i - 1];
+    for (std::size_t i = prices.size() - 1; i-- > 0;)
+        bidQuantities[i] += bidQuantities[i + 1];
+
+    // Most volume first, then the smallest imbalance, then the price closest to the last trade
+    auto Distance = [this](Price price) { return lastTradePrice_ ? std::abs(price - *lastTradePrice_) : 0; };
+    std::optional<AuctionEquilibrium> best;
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        const auto volume = std::min(bidQuantities[i], askQuantities[i]);
+        const auto imbalance = std::max(bidQuantities[i], askQuantities[i]) - volume;
+        const AuctionEquilibrium candidate {prices[i], volume, imbalance};
+
+        if (!best || candidate.volume_ > best->volume_
+            || (candidate.volume_ == best->volume_ && candidate.imbalance_ < best->imbalance_)
+            || (candidate.volume_ == best->volume_ && candidate.imbalance_ == best->imbalance_
+                && Distance(candidate.price_) < Distance(best->price_)))
+            best = candidate;
+    }
+    return best;
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::ExecuteAuction(Price price) {
+    Trades trades;
+
+    // The side with more quantity at price is rationed, bids when both are even
+    std::optional<Side> rationedSide;
+    if constexpr (MatchingPolicy::ProRata) {
+        std::uint64_t bidQuantity = 0;
+        std::uint64_t askQuantity = 0;
+        for (auto level = bids_.begin(); level != bids_.end() && level->first >= price; ++level)
+            for (const auto& order : level->second)
+                bidQuantity += order->GetOpenQuantity();
+        for (auto level = asks_.begin(); level != asks_.end() && level->first <= price; ++level)
+            for (const auto& order : level->second)
+                askQuantity += order->GetOpenQuantity();
+        rationedSide = askQuantity > bidQuantity ? Side::Sell : Side::Buy;
+    }
+
+    while (!bids_.empty() && !asks_.empty() && bids_.begin()->first >= price && asks_.begin()->first <= price) {
+        // Level data is kept per level price, only the trades report the auction price
+        const MatchSource bidSource {MatchSource::Kind::Limit, bids_.begin()->first};
+        const MatchSource askSource {MatchSource::Kind::Limit, asks_.begin()->first};
+        auto& bids = bids_.begin()->second;
+        auto& asks = asks_.begin()->second;
+        MatchLevels(bidSource, bids, askSource, asks, price, price, trades, rationedSide);
+
+        if (bids.empty()) bids_.erase(bids_.begin());
+        if (asks.empty()) asks_.erase(asks_.begin());
+    }
+
+    EngineMetrics::Increment(metrics_.trades_, trades.size());
+    return trades;
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::Uncross() {
+    if (session_ != TradingSession::Auction)
+        return {};
+    session_ = TradingSession::Continuous;
+
+    Trades trades;
+    if (const auto equilibrium = GetAuctionEquilibrium()) {
+        trades = ExecuteAuction(equilibrium->price_);
+        EngineMetrics::Increment(metrics_.auctions_);
+    }
+
+    // Anything still crossed, pegged orders included, trades continuously from here
+    auto continuousTrades = MatchOrders(CurrentPegReference());
+    trades.insert(trades.end(), continuousTrades.begin(), continuousTrades.end());
+
+    ActivateStopOrders(trades);
+    UpdateGauges();
+    return trades;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::CancelOrder(OrderId orderId) {
     std::scoped_lock ordersLock{ordersMutex_};
     CancelOrderInternal(orderId);
 }
 
-Trades OrderBook::Match(OrderModify order) {
+template <typename Traits>
+typename BasicOrderBook<Traits>::Trades BasicOrderBook<Traits>::Match(OrderModify order) {
+    // A modify carries a limit price, which means nothing to a pegged order and leaves a stop price out
+    if (pegOrders_.find(order.GetOrderId()) != pegOrders_.end() || stopOrders_.find(order.GetOrderId()) != stopOrders_.end())
+        throw std::invalid_argument("Pegged and stop orders cannot be modified, cancel and add them again");
     if (orders_.find(order.GetOrderId()) == orders_.end())
         return {};
 
-    const auto& [existingOrder, _] = orders_.at(order.GetOrderId());
+    // Build the replacement before cancelling, the cancel releases the entry existingOrder refers to
+    const auto& existingOrder = orders_.at(order.GetOrderId()).order_;
+    if (order.GetSide() == existingOrder->GetSide() && order.GetPrice() == existingOrder->GetPrice()
+        && order.GetQuantity() > 0 && order.GetQuantity() < existingOrder->GetOpenQuantity()) {
+        AmendOrder(existingOrder, order.GetQuantity());
+        return {};
+    }
+
+    auto replacement = order.ToOrderPointer(*existingOrder, Allocator<Order>{});
     CancelOrder(order.GetOrderId());
-    return AddOrder(order.ToOrderPointer(existingOrder->GetOrderType()));
+    return AddOrder(replacement);
+}
+
+template <typename Traits>
+std::size_t BasicOrderBook<Traits>::Size() const { 
+    return orders_.size() + pegOrders_.size(); 
+}
+
+template <typename Traits>
+std::size_t BasicOrderBook<Traits>::PeggedOrderCount() const {
+    return pegOrders_.size();
 }
 
-std::size_t OrderBook::Size() const { 
-    return orders_.size(); 
+template <typename Traits>
+std::size_t BasicOrderBook<Traits>::StopOrderCount() const {
+    return stopOrders_.size();
 }
 
-OrderBookLevelInfos OrderBook::GetOrderInfos() const {
+template <typename Traits>
+typename BasicOrderBook<Traits>::OrderBookLevelInfos BasicOrderBook<Traits>::GetOrderInfos() const {
     LevelInfos bidInfos, askInfos;
     bidInfos.reserve(orders_.size());
     askInfos.reserve(orders_.size());
 
-    auto CreateLevelInfos = [](Price price, const OrderPointers& orders) {
-        return LevelInfo{price, std::accumulate(orders.begin(), orders.end(), (Quantity)0,
+    auto LevelQuantity = [](const OrderPointers& orders) {
+        return std::accumulate(orders.begin(), orders.end(), (Quantity)0,
             [](std::size_t runningSum, const OrderPointer& order) 
             {return runningSum + order->GetRemainingQuantity();}
-        )};
+        );
     };
 
-    for (const auto& [price, orders] : bids_)
-        bidInfos.push_back(CreateLevelInfos(price, orders));
+    if (pegOrders_.empty()) {
+        for (const auto& [price, orders] : bids_)
+            bidInfos.push_back(LevelInfo{price, LevelQuantity(orders)});
+
+        for (const auto& [price, orders] : asks_)
+            askInfos.push_back(LevelInfo{price, LevelQuantity(orders)});
+
+        return OrderBookLevelInfos{bidInfos, askInfos};
+    }
+
+    // Pegged orders show at their current price, merged into any limit level at that price
+    const auto reference = CurrentPegReference();
+    auto Collect = [&](Side side, const auto& limits, const auto& pegs, auto& levels, LevelInfos& infos) {
+        for (const auto& [price, orders] : limits)
+            levels[price] += LevelQuantity(orders);
 
-    for (const auto& [price, orders] : asks_)
-        askInfos.push_back(CreateLevelInfos(price, orders));
+        for (const auto& [offset, orders] : pegs.primary_)
+            if (const auto price = PegPrice(OrderType::PrimaryPeg, side, offset, reference))
+                levels[*price] += LevelQuantity(orders);
+
+        for (const auto& [offset, orders] : pegs.midpoint_)
+            if (const auto price = PegPrice(OrderType::MidpointPeg, side, offset, reference))
+                levels[*price] += LevelQuantity(orders);
+
+        for (const auto& [price, quantity] : levels)
+            infos.push_back(LevelInfo{price, quantity});
+    };
+
+    std::map<Price, Quantity, std::greater<Price>> bidLevels;
+    std::map<Price, Quantity, std::less<Price>> askLevels;
+    Collect(Side::Buy, bids_, buyPegs_, bidLevels, bidInfos);
+    Collect(Side::Sell, asks_, sellPegs_, askLevels, askInfos);
 
     return OrderBookLevelInfos{bidInfos, askInfos};
-} 
\ No newline at end of file
+}
+
+template <typename Traits>
+std::size_t BasicOrderBook<Traits>::GetOrderSnapshot(OrderSnapshot* out, std::size_t capacity) const {
+    std::scoped_lock ordersLock{ordersMutex_};
+    std::size_t count = 0;
+
+    const auto reference = CurrentPegReference();
+    auto Collect = [&](Side side, const auto& limits, const auto& pegs) {
+        auto Better = [side](Price left, Price right) { return side == Side::Buy ? left > right : left < right; };
+        auto GroupPrice = [&](OrderType type, const auto& group, const auto& groups) -> std::optional<Price> {
+            if (group == groups.end())
+                return std::nullopt;
+            return PegPrice(type, side, group->first, reference);
+        };
+
+        auto limit = limits.begin();
+        auto primary = pegs.primary_.begin();
+        auto midpoint = pegs.midpoint_.begin();
+        std::optional<Price> levelPrice;
+        std::uint32_t position = 0;
+        auto Write = [&](const OrderPointers& orders) {
+            for (const auto& order : orders) {
+                if (count < capacity)
+                    out[count] = OrderSnapshot{order->GetOrderId(), *levelPrice, order->GetRemainingQuantity(), position, side};
+                ++count;
+                ++position;
+            }
+        };
+
+        // Pegs walk their offsets in price order, so the three sources merge like sorted lists. Pegs without a
+        // reference have no price and never show
+        while (true) {
+            const auto limitPrice = limit != limits.end() ? std::optional<Price>{limit->first} : std::nullopt;
+            const auto primaryPrice = GroupPrice(OrderType::PrimaryPeg, primary, pegs.primary_);
+            const auto midpointPrice = GroupPrice(OrderType::MidpointPeg, midpoint, pegs.midpoint_);
+
+            std::optional<Price> price;
+            for (const auto& candidate : {limitPrice, primaryPrice, midpointPrice})
+                if (candidate && (!price || Better(*candidate, *price)))
+                    price = candidate;
+            if (!price)
+                break;
+
+            // Two peg offsets can round to one price, their orders share the level
+            if (price != levelPrice) {
+                levelPrice = price;
+                position = 0;
+            }
+            // At one price limit orders trade first, then primary pegs, then midpoint pegs, as in BestSource
+            if (limitPrice == price)
+                Write((limit++)->second);
+            if (primaryPrice == price)
+                Write((primary++)->second);
+            if (midpointPrice == price)
+                Write((midpoint++)->second);
+        }
+    };
+
+    Collect(Side::Buy, bids_, buyPegs_);
+    Collect(Side::Sell, asks_, sellPegs_);
+    return count;
+}
+
+// Books for other traits need their own instantiation here
+template class BasicOrderBook<DefaultOrderBookTraits>;
+template class BasicOrderBook<MatchingTraits<ProRataMatching<>>>;
+template class BasicOrderBook<MatchingTraits<TopOrderProRataMatching<>>>;
+template class BasicOrderBook<WideOrderBookTraits>;
+template class BasicOrderBook<LadderOrderBookTraits<0, 65535>>;
+template class BasicOrderBook<TreeIndexOrderBookTraits>;
+template class BasicOrderBook<HugePageOrderBookTraits>;
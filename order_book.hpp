@@ -3,21 +3,61 @@
 #include "order.hpp"
 #include "order_modify.hpp"
 #include "trade.hpp"
-#include <condition_variable>
+#include "metrics.hpp"
+#include "matching_policy.hpp"
+#include "order_book_traits.hpp"
+#include <chrono>
 #include <map>
 #include <mutex>
-#include <thread>
 #include <unordered_map>
 #include <numeric>
+#include <optional>
 
-// Main order book implementation that manages orders and matches them
-class OrderBook
+class ItchEncoder;
+class TradeTape;
+class BarAggregator;
+
+// Main order book implementation that manages orders and matches them.
+// Traits choose the price and quantity widths, containers, allocator and matching policy, see order_book_traits.hpp.
+// The members are defined in order_book.cpp, which instantiates the book for the traits it ships with
+template <typename Traits = DefaultOrderBookTraits>
+class BasicOrderBook
 {
+    public:
+        // The order book types at the widths of Traits. They shadow the global ones, which are the default widths
+        using Price = typename Traits::Price;
+        using Quantity = typename Traits::Quantity;
+        using Order = BasicOrder<Price, Quantity>;
+        using OrderPointer = std::shared_ptr<Order>;
+        using OrderModify = BasicOrderModify<Price, Quantity>;
+        using PegOffset = BasicPegOffset<Price>;
+        using TradeInfo = BasicTradeInfo<Price, Quantity>;
+        using Trade = BasicTrade<Price, Quantity>;
+        using Trades = std::vector<Trade>;
+        using LevelInfo = BasicLevelInfo<Price, Quantity>;
+        using LevelInfos = std::vector<LevelInfo>;
+        using OrderBookLevelInfos = BasicOrderBookLevelInfos<Price, Quantity>;
+        using MassCancelFilter = BasicMassCancelFilter<Price>;
+        using MassCancelResult = BasicMassCancelResult<Price, Quantity>;
+        using AuctionEquilibrium = BasicAuctionEquilibrium<Price>;
+        using OrderSnapshot = BasicOrderSnapshot<Price, Quantity>;
+
     private:
+        template <typename T>
+        using Allocator = typename Traits::template Allocator<T>;
+        using OrderPointers = std::list<OrderPointer, Allocator<OrderPointer>>;
+        template <typename Compare>
+        using LevelStore = typename Traits::template LevelStore<Price, OrderPointers, Compare>;
+        using MatchingPolicy = typename Traits::Matching;
+        // Stop and peg levels stay in trees, they are keyed by stop price or peg offset and rarely walked
+        template <typename Compare>
+        using PriceMap = std::map<Price, OrderPointers, Compare, Allocator<std::pair<const Price, OrderPointers>>>;
+
         // Internal structure to keep track of order location in price level lists
         struct OrderEntry {
             OrderPointer order_ { nullptr };
-            OrderPointers::iterator location_;
+            typename OrderPointers::iterator location_;
+            typename OrderPointers::iterator ownerLocation_; // Position in ownerOrders_, only for orders with an owner
         };
 
         struct LevelData {
@@ -28,52 +68,247 @@ class OrderBook
             enum class Action {
                 Add,
                 Remove,
-                Match
+                Match,
+                Replenish // An iceberg showed its next tranche, quantity goes up but the order count does not
             };
         };
-        // Metadata
-        std::unordered_map<Price, LevelData> data_;
+        using OrderIndex = typename Traits::template OrderIndex<OrderEntry>;
+
+        // Metadata, per side: a book in an auction rests crossed, so a bid and an ask level can share a price
+        using LevelDataMap = std::unordered_map<Price, LevelData, std::hash<Price>, std::equal_to<Price>,
+            Allocator<std::pair<const Price, LevelData>>>;
+        LevelDataMap bidData_;
+        LevelDataMap askData_;
 
         // Price-time priority order book implementation
         // Bids are sorted in descending order (highest price first)
-        std::map<Price, OrderPointers, std::greater<Price>> bids_;
+        LevelStore<std::greater<Price>> bids_;
         // Asks are sorted in ascending order (lowest price first)
-        std::map<Price, OrderPointers, std::less<Price>> asks_;
+        LevelStore<std::less<Price>> asks_;
         // Quick lookup of orders by their ID
-        std::unordered_map<OrderId, OrderEntry> orders_; 
+        OrderIndex orders_; 
+
+        // Stop and stop limit orders waiting outside the visible book, keyed by stop price in trigger order.
+        // A buy stop triggers once the last trade price rises to its stop, a sell stop once it falls to it,
+        // so the next stop to trigger on each side is always at begin()
+        PriceMap<std::less<Price>> buyStops_;
+        PriceMap<std::greater<Price>> sellStops_;
+        OrderIndex stopOrders_;
+        // Price of the last execution, and the lowest and highest since the stops were last checked. A sweep can
+        // print through a stop price and move on, so buy stops are compared against the high and sell stops
+        // against the low
+        std::optional<Price> lastTradePrice_;
+        Price tradedLow_ {};
+        Price tradedHigh_ {};
+
+        // Best limit bid and ask, the reference prices of pegged orders
+        struct PegReference {
+            std::optional<Price> bid_;
+            std::optional<Price> ask_;
+        };
+
+        // Pegged orders rest relative to the reference instead of at a price, grouped by offset with the most
+        // aggressive offset at begin(). They are only priced when matching reaches them or depth is queried,
+        // so a move of the best bid or ask costs nothing per pegged order
+        template <typename Compare>
+        struct PegLevels {
+            PriceMap<Compare> primary_;
+            PriceMap<Compare> midpoint_;
+        };
+        PegLevels<std::greater<Price>> buyPegs_;
+        PegLevels<std::less<Price>> sellPegs_;
+        OrderIndex pegOrders_;
+
+        // Live orders of each owner, resting, pegged and pending stops alike, so a mass cancel by owner
+        // walks only that owner's orders
+        std::unordered_map<OwnerId, OrderPointers, std::hash<OwnerId>, std::equal_to<OwnerId>,
+            Allocator<std::pair<const OwnerId, OrderPointers>>> ownerOrders_;
+
+        TradingSession session_ {TradingSession::Continuous};
+
+        // How many ticks past the best opposite price at arrival a market order may trade, unbounded when empty
+        std::optional<Price> marketProtection_;
+
+        // Where book events go as market data, none when null
+        ItchEncoder* marketData_ {nullptr};
+        // Where trades are kept for time and sales, none when null
+        TradeTape* tradeTape_ {nullptr};
+        // Where trades are rolled up into OHLCV bars, none when null
+        BarAggregator* bars_ {nullptr};
+        // The order being added while it matches. Its add is published once it rests, with what is left of it,
+        // and its own executions, reloads and cancels until then are not
+        const Order* incoming_ {nullptr};
+
+        // Scratch space of pro-rata matching, kept to avoid allocating per level
+        std::vector<typename OrderPointers::iterator> proRataPositions_;
+        std::vector<Quantity> proRataResting_;
+        std::vector<Quantity> proRataAllocations_;
+
+        // Last sequence stamped on an order entering the book
+        std::uint64_t sequence_ {};
+
+        // The best orders of one side: the front limit level or the front group of one kind of pegged order
+        struct MatchSource {
+            enum class Kind {
+                Limit,
+                PrimaryPeg,
+                MidpointPeg,
+                Incoming // The order being swept in, held in a local list outside the book
+            };
+            Kind kind_;
+            Price price_; // Price these orders trade at
+        };
 
         mutable std::mutex ordersMutex_;
-        std::thread ordersPruneThread_;
-        std::condition_variable shutdownConditionVariable_;
-        std::atomic<bool> shutdown_ {false};
 
-        void PruneGoodForDayOrder();
+        EngineMetrics metrics_;
 
         void CancelOrders(OrderIds orderIds);
         void CancelOrderInternal(OrderId orderId);
+        // Take an order out of whichever container holds it, null if it is unknown.
+        // Level data, metrics and gauges are left to the caller
+        OrderPointer UnlinkOrder(OrderId orderId);
+        typename OrderPointers::iterator LinkOwner(const OrderPointer& order);
+        // Erase an order from one of the id indexes and from its owner's list
+        void EraseEntry(OrderIndex& index, OrderId orderId);
 
         // Making our lives easier with event based API's
         void OnOrderCancelled(OrderPointer order);
         void OnOrderAdded(OrderPointer order);
-        void OnOrderMatched(Price price, Quantity quantity, bool isFullyFilled);
-        void UpdateLevelData(Price price, Quantity quantity, LevelData::Action action);
+        // traded is false for quantity taken out by self trade prevention, which reports no trade
+        void OnOrderMatched(const OrderPointer& order, Price price, Quantity quantity, bool traded);
+        void OnOrderReplenished(OrderPointer order);
+        void OnTrade(const Trade& trade, const OrderPointer& bid, const OrderPointer& ask);
+        void UpdateLevelData(Side side, Price price, Quantity quantity, typename LevelData::Action action);
+        // Publish order/level counts and the memory estimate to metrics_
+        void UpdateGauges();
+        // Insert a (non stop) order into the book and match it
+        Trades AddOrderInternal(OrderPointer order);
+        void AddStopOrder(OrderPointer order);
+        // Remove the next stop order whose stop price the last trade price has reached, nullptr if there is none
+        OrderPointer PopTriggeredStopOrder();
+        // Inject triggered stop orders through the normal add path until no more trigger, appending their trades
+        void ActivateStopOrders(Trades& trades);
+        Trades AddPeggedOrder(OrderPointer order);
+        Trades AddMarketOrder(OrderPointer order);
+        // Match order against the opposite side without inserting it, trading no further than limit when set.
+        // Whatever is left of it is dropped
+        Trades SweepOrder(OrderPointer order, const PegReference& reference, std::optional<Price> limit);
+        // A new best bid or ask reprices the pegged orders, which can leave them crossed with each other
+        void MatchRepricedPegs(Trades& trades);
+        void AmendOrder(const OrderPointer& order, Quantity quantity);
+        void RecordExecutionPrice(Price price);
+
+        PegReference CurrentPegReference() const;
+        // Price of a pegged order against reference, empty while the reference it follows is missing
+        static std::optional<Price> PegPrice(OrderType type, Side side, Price offset, const PegReference& reference);
+        // Best limit level or pegged group of a side with pegs priced against reference. Limits win price ties
+        std::optional<MatchSource> BestSource(Side side, const PegReference& reference) const;
+        // Calls function with the map holding the levels of a source, whose best level is at begin()
+        template <typename Function>
+        decltype(auto) VisitSourceLevels(Side side, typename MatchSource::Kind kind, Function function);
+        // Remove the front order of a level being matched. Erasing the level is left to MatchOrders
+        void CancelFrontOrder(const MatchSource& source, OrderPointers& orders);
+        // Resolve a cross between the front orders of two sources with the same owner. False if they have no owner
+        bool PreventSelfTrade(const MatchSource& bidSource, OrderPointers& bids, const MatchSource& askSource, OrderPointers& asks);
+        // Level data, trace and removal of an order that just traded quantity out of source, see OnOrderMatched for traded
+        void SettleMatchedOrder(const MatchSource& source, OrderPointers& orders, typename OrderPointers::iterator position, Quantity quantity,
+            bool traded);
+
+        // Fill the front orders of a crossing bid and ask source against each other until one of them runs out.
+        // Trades report bidPrice and askPrice
+        // rationedSide is the side pro-rata policies split, by default the one whose front arrived first
+        void MatchLevels(const MatchSource& bidSource, OrderPointers& bids, const MatchSource& askSource, OrderPointers& asks,
+            Price bidPrice, Price askPrice, Trades& trades, std::optional<Side> rationedSide = std::nullopt);
+        // MatchLevels for pro-rata policies: the side whose front arrived last, or the side other than rationedSide,
+        // is the aggressor, its orders are split over the other level one at a time
+        void MatchLevelsProRata(const MatchSource& bidSource, OrderPointers& bids, const MatchSource& askSource, OrderPointers& asks,
+            Price bidPrice, Price askPrice, Trades& trades, std::optional<Side> rationedSide);
+        // Execute every limit order that crosses price, all at price. An uncross has no aggressor, so pro-rata
+        // policies split the side with more quantity at price, the one that cannot fill completely, and the other
+        // side fills in time priority
+        Trades ExecuteAuction(Price price);
+
         // Check if an order can be matched at the given price
         bool CanMatch(Side side, Price price) const;
-        // Match orders and generate trades
-        Trades MatchOrders();
+        // Match orders and generate trades. Pegged orders are priced against reference while matching
+        Trades MatchOrders(const PegReference& reference);
 
     public:
+        // The book runs no thread of its own, GoodForDay orders go when the owner calls PruneGoodForDay
+        BasicOrderBook() = default;
+        BasicOrderBook(const BasicOrderBook&) = delete;
+        BasicOrderBook& operator=(const BasicOrderBook&) = delete;
+
+        // Make an order with the book's allocator, so orders live in the same memory as the containers holding them
+        template <typename... Args>
+        static OrderPointer MakeOrder(Args&&... args)
+        {
+            return std::allocate_shared<Order>(Allocator<Order>{}, std::forward<Args>(args)...);
+        }
+
         // Add a new order to the book and match it if possible
         Trades AddOrder(OrderPointer order);
         // Cancel an existing order
         void CancelOrder(OrderId orderId);
-        // Modify an existing order
+        // Start a call auction: orders are accepted without matching. FillAndKill, FillOrKill and market orders are rejected
+        void BeginAuction();
+        // End the auction: execute at the equilibrium price, then return to continuous trading
+        Trades Uncross();
+        TradingSession GetSession() const { return session_; }
+        // Market orders trade at most ticks away from the best opposite price they arrive to, the rest is dropped.
+        // Empty removes the band
+        void SetMarketProtection(std::optional<Price> ticks) { marketProtection_ = ticks; }
+        // Report adds, executions, cancels and trades to encoder (itch_encoder.hpp), null stops it. The encoder is
+        // only called on the thread that owns the book, which must also be the one setting it, and must outlive
+        // the book or be replaced first
+        void SetMarketDataEncoder(ItchEncoder* encoder);
+        // Record every trade on tape (trade_tape.hpp), null stops it. Like the encoder it is only written on the
+        // thread that owns the book and must outlive the book or be replaced first
+        void SetTradeTape(TradeTape* tape);
+        // Update bars (bar_aggregator.hpp) with every trade, null stops it. Same rules as the tape
+        void SetBarAggregator(BarAggregator* bars);
+        // Price and volume the auction would execute at right now, empty if the book does not cross
+        std::optional<AuctionEquilibrium> GetAuctionEquilibrium() const;
+        // Cancel every order matching filter in one pass under one lock
+        MassCancelResult MassCancel(const MassCancelFilter& filter);
+        // Modify an existing order. A smaller quantity at the same price and side is amended in place and keeps
+        // its queue position, any other change cancels and replaces the order. std::invalid_argument for pegged
+        // and stop orders, which have to be cancelled and added again
         Trades Match(OrderModify order);
         // Get the total number of orders in the book
         std::size_t Size() const;
+        // Number of stop orders waiting for their stop price
+        std::size_t StopOrderCount() const;
+        // Number of pegged orders, included in Size()
+        std::size_t PeggedOrderCount() const;
         // Get the current state of the order book
         OrderBookLevelInfos GetOrderInfos() const;
+        // Every resting order (L3), bids then asks, best level first and in matching priority within a level.
+        // Writes up to capacity orders to out and returns how many rest, call again with a larger buffer when
+        // that is more than capacity. Pegged orders show at their current price, stop orders are not resting
+        std::size_t GetOrderSnapshot(OrderSnapshot* out, std::size_t capacity) const;
         // Difference between CanMatch and CanFullyFill:
         // CanMatch answers if the orderbook can allow a trade and we call that in CanFullyFill
-        bool CanFullyFill(Side side, Price price, Quantity quantity) const;
-}; 
\ No newline at end of file
+        // With an owner, its own resting orders are left out as self trade prevention would never let them
+        // trade, and unless selfTradePrevention is CancelOldest the order itself goes on meeting one
+        bool CanFullyFill(Side side, Price price, Quantity quantity, OwnerId owner = Constants::NoOwner,
+            SelfTradePrevention selfTradePrevention = SelfTradePrevention::CancelNewest) const;
+        // Cancel every GoodForDay order and return how many. Call it at the close (NextGoodForDayClose) on the
+        // thread that owns the book, like any other change to it
+        std::size_t PruneGoodForDay();
+        // When GoodForDay orders expire next after now: 16:00 local time
+        static std::chrono::system_clock::time_point NextGoodForDayClose(std::chrono::system_clock::time_point now);
+        // Engine counters and gauges. Safe to read from any thread without locking
+        const EngineMetrics& GetMetrics() const { return metrics_; }
+};
+
+// Price-time priority book
+using OrderBook = BasicOrderBook<DefaultOrderBookTraits>;
+using ProRataOrderBook = BasicOrderBook<MatchingTraits<ProRataMatching<>>>;
+using TopOrderProRataOrderBook = BasicOrderBook<MatchingTraits<TopOrderProRataMatching<>>>;
+using WideOrderBook = BasicOrderBook<WideOrderBookTraits>;
+// Ladder over prices 0 to 65535 ticks
+using LadderOrderBook = BasicOrderBook<LadderOrderBookTraits<0, 65535>>;
+using TreeIndexOrderBook = BasicOrderBook<TreeIndexOrderBookTraits>;
+using HugePageOrderBook = BasicOrderBook<HugePageOrderBookTraits>;
\ No newline at end of file
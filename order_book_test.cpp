@@ -1,7 +1,25 @@
 #include <gtest/gtest.h>
 #include "order_book.hpp"
+#include "itch_encoder.hpp"
+#include "trade_tape.hpp"
+#include "bar_aggregator.hpp"
+#include "backtest_runner.hpp"
+#include "order_flow.hpp"
+#include "feed_handler.hpp"
+#include "matching_loop.hpp"
+#include "shm_gateway.hpp"
+#include "tcp_gateway.hpp"
 #include "order.hpp"
+#include "trace.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <unistd.h>
 
 class OrderBookTest : public ::testing::Test {
 protected:
@@ -98,6 +116,1152 @@ TEST_F(OrderBookTest, PartialFills) {
     EXPECT_FALSE(orderBook->CanFullyFill(Side::Buy, 100, 101)); // One more than available
 }
 
+// Test that an iceberg only shows its display quantity in the level aggregates
+TEST_F(OrderBookTest, IcebergShowsDisplayQuantityOnly) {
+    orderBook->AddOrder(std::make_shared<Order>(1, Side::Sell, 100, 100, 10));
+
+    const auto asks = orderBook->GetOrderInfos().GetAsks();
+    ASSERT_EQ(asks.size(), 1u);
+    EXPECT_EQ(asks[0].quantity_, 10u);
+    EXPECT_TRUE(orderBook->CanFullyFill(Side::Buy, 100, 100)); // The reserve is hidden, but it still fills
+    EXPECT_FALSE(orderBook->CanFullyFill(Side::Buy, 100, 101));
+}
+
+// Test that a consumed tranche reloads from the reserve and loses time priority
+TEST_F(OrderBookTest, IcebergReplenishesAtBackOfLevel) {
+    orderBook->AddOrder(std::make_shared<Order>(1, Side::Sell, 100, 25, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 100, 5));
+
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 100, 12));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].geAskTrade().orderId_, 1u);
+    EXPECT_EQ(trades[0].geAskTrade().quantity_, 10u);
+    EXPECT_EQ(trades[1].geAskTrade().orderId_, 2u); // The iceberg requeued behind order 2
+    EXPECT_EQ(trades[1].geAskTrade().quantity_, 2u);
+
+    const auto asks = orderBook->GetOrderInfos().GetAsks();
+    ASSERT_EQ(asks.size(), 1u);
+    EXPECT_EQ(asks[0].quantity_, 13u); // New 10 lot tranche plus 3 left on order 2
+    EXPECT_EQ(orderBook->Size(), 2u);
+
+    // Take everything: 3 from order 2, then the iceberg's last two tranches (10 + 5)
+    trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 100, 18));
+    EXPECT_EQ(orderBook->Size(), 0u);
+    EXPECT_TRUE(orderBook->GetOrderInfos().GetAsks().empty());
+}
+
+// Test that an aggressive iceberg trades its full quantity, not only the first tranche
+TEST_F(OrderBookTest, AggressiveIcebergTradesThroughReserve) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 30));
+
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(2, Side::Buy, 100, 35, 10));
+    Quantity traded = 0;
+    for (const auto& trade : trades)
+        traded += trade.getBidTrade().quantity_;
+    EXPECT_EQ(traded, 30u);
+
+    const auto bids = orderBook->GetOrderInfos().GetBids();
+    ASSERT_EQ(bids.size(), 1u);
+    EXPECT_EQ(bids[0].quantity_, 5u); // Last, partial tranche
+}
+
+// Test that a FillOrKill counts the reserve of an iceberg, which a sweep trades through
+TEST_F(OrderBookTest, FillOrKillCountsIcebergReserve) {
+    orderBook->AddOrder(std::make_shared<Order>(1, Side::Sell, 100, 30, 5));
+
+    const auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::FillOrKill, 2, Side::Buy, 100, 20));
+    EXPECT_EQ(trades.size(), 4u);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetAsks()[0].quantity_, 5u);
+}
+
+// Test that a FillOrKill counts pegged orders at the price they have, in the order a sweep takes them
+TEST_F(OrderBookTest, FillOrKillCountsPeggedOrders) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 99, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 101, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::MidpointPeg, 3, Side::Sell, PegOffset{0}, 10));
+    EXPECT_FALSE(orderBook->CanFullyFill(Side::Buy, 101, 21));
+
+    const auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::FillOrKill, 4, Side::Buy, 101, 15));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].geAskTrade().orderId_, 3u);
+    EXPECT_EQ(trades[0].geAskTrade().price_, 100);
+    EXPECT_EQ(trades[1].geAskTrade().orderId_, 2u);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetAsks()[0].quantity_, 5u);
+}
+
+// Test that a stop limit waits outside the book and enters it once a trade reaches its stop price
+TEST_F(OrderBookTest, StopLimitTriggersOnLastTradePrice) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 101, 10));
+
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::StopLimit, 3, Side::Buy, 101, 100, 5));
+    EXPECT_TRUE(trades.empty());
+    EXPECT_EQ(orderBook->StopOrderCount(), 1u);
+    EXPECT_EQ(orderBook->Size(), 2u); // Not in the visible book
+    EXPECT_TRUE(orderBook->GetOrderInfos().GetBids().empty());
+
+    trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 100, 10));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[1].getBidTrade().orderId_, 3u);
+    EXPECT_EQ(trades[1].geAskTrade().price_, 101);
+    EXPECT_EQ(orderBook->StopOrderCount(), 0u);
+}
+
+// Test that several crossed stops fire in stop price order and can cascade
+TEST_F(OrderBookTest, StopOrdersTriggerInStopPriceOrder) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 97, 5));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 95, 5));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 93, 5));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::Stop, 10, Side::Sell, Constants::InvalidPrice, 95, 5));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::Stop, 11, Side::Sell, Constants::InvalidPrice, 97, 5));
+    EXPECT_EQ(orderBook->StopOrderCount(), 2u);
+
+    // A trade at 97 triggers the 97 stop, which sells into 95 and triggers the 95 stop, which sells into 93
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 97, 5));
+    ASSERT_EQ(trades.size(), 3u);
+    EXPECT_EQ(trades[1].geAskTrade().orderId_, 11u);
+    EXPECT_EQ(trades[1].getBidTrade().price_, 95);
+    EXPECT_EQ(trades[2].geAskTrade().orderId_, 10u);
+    EXPECT_EQ(trades[2].getBidTrade().price_, 93);
+    EXPECT_EQ(orderBook->StopOrderCount(), 0u);
+    EXPECT_EQ(orderBook->Size(), 0u);
+}
+
+// Test that a sweep triggers stops it printed through, not only those at its last price
+TEST_F(OrderBookTest, StopsTriggerOnEveryPriceOfASweep) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 105, 1));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 105, 1));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::Stop, 3, Side::Sell, Constants::InvalidPrice, 101, 5));
+    EXPECT_EQ(orderBook->StopOrderCount(), 1u);
+
+    // Prints 100 then 102: the last price is above the stop, but the sweep traded below it on the way
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Sell, 102, 10));
+    const auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 6, Side::Buy, 102, 15));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[1].geAskTrade().price_, 102);
+    EXPECT_EQ(orderBook->StopOrderCount(), 0u);
+    EXPECT_EQ(orderBook->GetMetrics().stopsTriggered_.load(), 1u);
+}
+
+// Test that a stop reached during an auction waits for the uncross instead of being dropped as a market order
+TEST_F(OrderBookTest, StopsWaitForTheUncross) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 1));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 100, 1));
+
+    orderBook->BeginAuction();
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 101, 5));
+    EXPECT_TRUE(orderBook->AddOrder(std::make_shared<Order>(OrderType::Stop, 4, Side::Buy, Constants::InvalidPrice, 99, 5)).empty());
+    EXPECT_EQ(orderBook->StopOrderCount(), 1u);
+
+    const auto trades = orderBook->Uncross();
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 4u);
+    EXPECT_EQ(trades[0].geAskTrade().price_, 101);
+    EXPECT_EQ(orderBook->StopOrderCount(), 0u);
+    EXPECT_EQ(orderBook->Size(), 0u);
+}
+
+// Test that a pending stop order can be cancelled
+TEST_F(OrderBookTest, CancelPendingStopOrder) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::StopLimit, 1, Side::Buy, 105, 104, 5));
+    orderBook->CancelOrder(1);
+    EXPECT_EQ(orderBook->StopOrderCount(), 0u);
+
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 104, 5));
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 104, 1));
+    EXPECT_EQ(trades.size(), 1u);
+    EXPECT_EQ(orderBook->Size(), 1u); // The cancelled stop did not come back
+}
+
+TEST_F(OrderBookTest, MidpointPegTradesInsideSpread) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 104, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::MidpointPeg, 3, Side::Buy, PegOffset{0}, 5));
+
+    // Shown at the midpoint of 100 and 104
+    auto infos = orderBook->GetOrderInfos();
+    ASSERT_EQ(infos.GetBids().size(), 2u);
+    EXPECT_EQ(infos.GetBids()[0].price_, 102);
+    EXPECT_EQ(infos.GetBids()[0].quantity_, 5u);
+
+    // The sell inside the spread trades with the peg at the midpoint it had before the sell arrived
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 101, 8));
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 3u);
+    EXPECT_EQ(trades[0].getBidTrade().price_, 102);
+    EXPECT_EQ(trades[0].getBidTrade().quantity_, 5u);
+    EXPECT_EQ(orderBook->PeggedOrderCount(), 0u);
+    EXPECT_EQ(orderBook->Size(), 3u);
+}
+
+TEST_F(OrderBookTest, PrimaryPegFollowsBestBid) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::PrimaryPeg, 2, Side::Buy, PegOffset{-1}, 5));
+    EXPECT_EQ(orderBook->GetOrderInfos().GetBids()[1].price_, 99);
+
+    // No order is touched when the best bid moves, the peg is priced against it when read
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 102, 10));
+    auto bids = orderBook->GetOrderInfos().GetBids();
+    ASSERT_EQ(bids.size(), 3u);
+    EXPECT_EQ(bids[0].price_, 102);
+    EXPECT_EQ(bids[1].price_, 101);
+    EXPECT_EQ(bids[1].quantity_, 5u);
+
+    // Limit orders at the same price trade first, then the peg
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::FillAndKill, 4, Side::Sell, 101, 12));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 3u);
+    EXPECT_EQ(trades[1].getBidTrade().orderId_, 2u);
+    EXPECT_EQ(trades[1].getBidTrade().price_, 101);
+
+    orderBook->CancelOrder(2);
+    EXPECT_EQ(orderBook->PeggedOrderCount(), 0u);
+    EXPECT_EQ(orderBook->Size(), 1u);
+}
+
+TEST_F(OrderBookTest, OrderSnapshotListsOrdersInPriority) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 101, 4));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::PrimaryPeg, 3, Side::Buy, PegOffset{-1}, 5));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 100, 3));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Sell, 104, 7));
+
+    // A short buffer gets the best orders and the count a full one needs
+    std::vector<OrderSnapshot> snapshot(2);
+    ASSERT_EQ(orderBook->GetOrderSnapshot(snapshot.data(), snapshot.size()), 5u);
+    EXPECT_EQ(snapshot[0].orderId_, 2u);
+    EXPECT_EQ(snapshot[1].orderId_, 1u);
+
+    // The peg at 100 queues behind the limit orders there, whenever they arrived
+    snapshot.resize(5);
+    ASSERT_EQ(orderBook->GetOrderSnapshot(snapshot.data(), snapshot.size()), 5u);
+    const std::vector<std::tuple<OrderId, Price, Quantity, std::uint32_t, Side>> expected {
+        {2, 101, 4, 0, Side::Buy}, {1, 100, 10, 0, Side::Buy}, {4, 100, 3, 1, Side::Buy},
+        {3, 100, 5, 2, Side::Buy}, {5, 104, 7, 0, Side::Sell}};
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        const auto& order = snapshot[i];
+        EXPECT_EQ(std::make_tuple(order.orderId_, order.price_, order.quantity_, order.position_, order.side_), expected[i]) << i;
+    }
+}
+
+TEST_F(OrderBookTest, MidpointPegsCrossAtEvenSpread) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 103, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::MidpointPeg, 3, Side::Buy, PegOffset{0}, 5));
+    // Odd spread: buy rests at 101, sell at 102
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::MidpointPeg, 4, Side::Sell, PegOffset{0}, 5));
+    EXPECT_TRUE(trades.empty());
+
+    // Moving the best ask to 102 puts both pegs on the midpoint 101
+    trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Sell, 102, 10));
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 3u);
+    EXPECT_EQ(trades[0].geAskTrade().orderId_, 4u);
+    EXPECT_EQ(trades[0].geAskTrade().price_, 101);
+}
+
+TEST_F(OrderBookTest, PostOnlyNeverTakesLiquidity) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+
+    auto reject = std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 101, 5);
+    reject->SetPostOnly(PostOnly::Reject);
+    EXPECT_TRUE(orderBook->AddOrder(reject).empty());
+    EXPECT_EQ(orderBook->Size(), 1u);
+
+    auto slide = std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 101, 5);
+    slide->SetPostOnly(PostOnly::Slide);
+    EXPECT_TRUE(orderBook->AddOrder(slide).empty());
+    EXPECT_EQ(slide->GetPrice(), 99);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetBids()[0].price_, 99);
+
+    // A post only order that does not cross rests at its own price
+    auto rest = std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 102, 5);
+    rest->SetPostOnly(PostOnly::Reject);
+    orderBook->AddOrder(rest);
+    EXPECT_EQ(orderBook->Size(), 3u);
+
+    EXPECT_EQ(orderBook->GetMetrics().postOnlyRejected_.load(), 1u);
+    EXPECT_EQ(orderBook->GetMetrics().postOnlySlid_.load(), 1u);
+    EXPECT_THROW(std::make_shared<Order>(OrderType::FillAndKill, 5, Side::Buy, 100, 1)->SetPostOnly(PostOnly::Reject), std::logic_error);
+}
+
+TEST_F(OrderBookTest, SelfTradePreventionCancelsNewest) {
+    auto resting = std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10);
+    resting->SetOwner(7);
+    orderBook->AddOrder(resting);
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 99, 10));
+
+    auto incoming = std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 99, 5);
+    incoming->SetOwner(7);
+    EXPECT_TRUE(orderBook->AddOrder(incoming).empty());
+    EXPECT_EQ(orderBook->Size(), 2u);
+    EXPECT_EQ(orderBook->GetMetrics().selfTradesPrevented_.load(), 1u);
+
+    // Another owner trades normally
+    auto other = std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 100, 5);
+    other->SetOwner(8);
+    EXPECT_EQ(orderBook->AddOrder(other).size(), 1u);
+}
+
+TEST_F(OrderBookTest, SelfTradePreventionCancelOldestAndDecrement) {
+    auto resting = std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10);
+    resting->SetOwner(7);
+    orderBook->AddOrder(resting);
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 99, 10));
+
+    // The resting order of the same owner goes, the incoming one trades on with the next level
+    auto oldest = std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 99, 4);
+    oldest->SetOwner(7, SelfTradePrevention::CancelOldest);
+    auto trades = orderBook->AddOrder(oldest);
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 2u);
+
+    auto second = std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 99, 10);
+    second->SetOwner(9);
+    orderBook->AddOrder(second);
+
+    // Order 2 trades its last 6, then 10 come off both sides without a trade: order 4 is used up, order 5 rests with 4
+    auto decrement = std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Sell, 99, 20);
+    decrement->SetOwner(9, SelfTradePrevention::Decrement);
+    trades = orderBook->AddOrder(decrement);
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 2u);
+    EXPECT_EQ(trades[0].getBidTrade().quantity_, 6u);
+    EXPECT_EQ(second->GetRemainingQuantity(), 0u);
+    EXPECT_EQ(decrement->GetRemainingQuantity(), 4u);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetAsks()[0].quantity_, 4u);
+}
+
+// Test that a FillOrKill order does not count its owner's resting orders, which self trade prevention keeps it from trading
+TEST_F(OrderBookTest, FillOrKillLeavesOutItsOwnersOrders) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 5));
+    auto own = std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 100, 10);
+    own->SetOwner(7);
+    orderBook->AddOrder(own);
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 101, 10));
+
+    // Cancelled on meeting order 2 after trading 5 of 12, so it must not trade at all
+    auto newest = std::make_shared<Order>(OrderType::FillOrKill, 4, Side::Buy, 101, 12);
+    newest->SetOwner(7);
+    EXPECT_TRUE(orderBook->AddOrder(newest).empty());
+    EXPECT_EQ(orderBook->Size(), 3u);
+    EXPECT_EQ(orderBook->GetMetrics().selfTradesPrevented_.load(), 0u);
+
+    // Order 2 would be cancelled, so only the 15 of the other orders count
+    auto tooLarge = std::make_shared<Order>(OrderType::FillOrKill, 5, Side::Buy, 101, 16);
+    tooLarge->SetOwner(7, SelfTradePrevention::CancelOldest);
+    EXPECT_TRUE(orderBook->AddOrder(tooLarge).empty());
+    EXPECT_EQ(orderBook->Size(), 3u);
+
+    auto oldest = std::make_shared<Order>(OrderType::FillOrKill, 6, Side::Buy, 101, 15);
+    oldest->SetOwner(7, SelfTradePrevention::CancelOldest);
+    const auto trades = orderBook->AddOrder(oldest);
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].geAskTrade().orderId_, 1u);
+    EXPECT_EQ(trades[1].geAskTrade().orderId_, 3u);
+    EXPECT_EQ(orderBook->Size(), 0u);
+}
+
+TEST_F(OrderBookTest, MassCancelByOwnerSideAndPrice) {
+    auto Add = [&](OrderId id, Side side, Price price, OwnerId owner) {
+        auto order = std::make_shared<Order>(OrderType::GoodTillCancel, id, side, price, 10);
+        order->SetOwner(owner);
+        orderBook->AddOrder(order);
+    };
+    Add(1, Side::Buy, 100, 7);
+    Add(2, Side::Buy, 100, 8);
+    Add(3, Side::Buy, 98, 7);
+    Add(4, Side::Sell, 103, 7);
+    Add(5, Side::Sell, 104, 8);
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::StopLimit, 6, Side::Buy, 105, 104, 5));
+
+    MassCancelFilter filter;
+    filter.owner_ = 7;
+    filter.side_ = Side::Buy;
+    filter.minPrice_ = 99;
+    auto result = orderBook->MassCancel(filter);
+    EXPECT_EQ(result.cancelled_, 1u);
+    ASSERT_EQ(result.bids_.size(), 1u);
+    EXPECT_EQ(result.bids_[0].price_, 100);
+    EXPECT_EQ(result.bids_[0].quantity_, 10u);
+    EXPECT_TRUE(result.asks_.empty());
+
+    // The rest of owner 7 on both sides
+    result = orderBook->MassCancel(MassCancelFilter{7, std::nullopt, std::nullopt, std::nullopt});
+    EXPECT_EQ(result.cancelled_, 2u);
+    EXPECT_EQ(result.bids_[0].quantity_, 0u);
+    EXPECT_EQ(result.asks_[0].price_, 103);
+    EXPECT_EQ(result.asks_[0].quantity_, 0u);
+    EXPECT_EQ(orderBook->Size(), 2u);
+
+    // No filter clears the book, pending stops included
+    result = orderBook->MassCancel({});
+    EXPECT_EQ(result.cancelled_, 3u);
+    EXPECT_EQ(orderBook->Size(), 0u);
+    EXPECT_EQ(orderBook->StopOrderCount(), 0u);
+    EXPECT_TRUE(orderBook->GetOrderInfos().GetBids().empty());
+}
+
+// Test that bids and asks resting crossed at one price in an auction keep their own level data
+TEST_F(OrderBookTest, MassCancelKeepsCrossedSidesApart) {
+    orderBook->BeginAuction();
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 7));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 100, 5));
+
+    MassCancelFilter filter;
+    filter.side_ = Side::Sell;
+    auto result = orderBook->MassCancel(filter);
+    ASSERT_EQ(result.asks_.size(), 1u);
+    EXPECT_EQ(result.asks_[0].price_, 100);
+    EXPECT_EQ(result.asks_[0].quantity_, 0u);
+
+    filter.side_ = Side::Buy;
+    result = orderBook->MassCancel(filter);
+    ASSERT_EQ(result.bids_.size(), 1u);
+    EXPECT_EQ(result.bids_[0].quantity_, 0u);
+    EXPECT_EQ(orderBook->Size(), 0u);
+}
+
+TEST_F(OrderBookTest, QuantityDecreaseKeepsQueuePosition) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 100, 10));
+
+    EXPECT_TRUE(orderBook->Match(OrderModify{1, Side::Buy, 100, 4}).empty());
+    EXPECT_EQ(orderBook->GetOrderInfos().GetBids()[0].quantity_, 14u);
+    EXPECT_EQ(orderBook->GetMetrics().ordersAmended_.load(), 1u);
+
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 100, 4));
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 1u);
+
+    // An increase loses priority: order 2 is replaced behind order 4
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 100, 5));
+    orderBook->Match(OrderModify{2, Side::Buy, 100, 12});
+    trades = orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Sell, 100, 5));
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().orderId_, 4u);
+}
+
+// Test that pegged and stop orders are refused by a modify and stay as they were
+TEST_F(OrderBookTest, ModifyRejectsPeggedAndStopOrders) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 99, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::MidpointPeg, 2, Side::Buy, PegOffset{0}, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::StopLimit, 3, Side::Buy, 105, 104, 10));
+
+    EXPECT_THROW(orderBook->Match(OrderModify{2, Side::Buy, 100, 5}), std::invalid_argument);
+    EXPECT_THROW(orderBook->Match(OrderModify{3, Side::Buy, 106, 5}), std::invalid_argument);
+    EXPECT_EQ(orderBook->PeggedOrderCount(), 1u);
+    EXPECT_EQ(orderBook->StopOrderCount(), 1u);
+    EXPECT_EQ(orderBook->Size(), 2u);
+}
+
+TEST_F(OrderBookTest, IcebergAmendTakesReserveFirst) {
+    auto iceberg = std::make_shared<Order>(1, Side::Sell, 100, 30, 10);
+    orderBook->AddOrder(iceberg);
+
+    orderBook->Match(OrderModify{1, Side::Sell, 100, 15});
+    EXPECT_EQ(iceberg->GetRemainingQuantity(), 10u);
+    EXPECT_EQ(iceberg->GetReserveQuantity(), 5u);
+
+    orderBook->Match(OrderModify{1, Side::Sell, 100, 6});
+    EXPECT_EQ(iceberg->GetRemainingQuantity(), 6u);
+    EXPECT_EQ(iceberg->GetReserveQuantity(), 0u);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetAsks()[0].quantity_, 6u);
+}
+
+TEST_F(OrderBookTest, AuctionUncrossesAtMaximumVolumePrice) {
+    orderBook->BeginAuction();
+    EXPECT_TRUE(orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 105, 30)).empty());
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 103, 20));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 102, 25));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Sell, 104, 40));
+    // Immediate orders cannot wait for the uncross
+    EXPECT_TRUE(orderBook->AddOrder(std::make_shared<Order>(OrderType::FillAndKill, 6, Side::Buy, 110, 5)).empty());
+    EXPECT_EQ(orderBook->Size(), 5u);
+
+    // At 103: bids 50, asks 35. At 104: bids 30, asks 75. At 102: bids 50, asks 35 with the same imbalance
+    auto equilibrium = orderBook->GetAuctionEquilibrium();
+    ASSERT_TRUE(equilibrium.has_value());
+    EXPECT_EQ(equilibrium->volume_, 35u);
+    EXPECT_EQ(equilibrium->imbalance_, 15u);
+
+    auto trades = orderBook->Uncross();
+    EXPECT_EQ(orderBook->GetSession(), TradingSession::Continuous);
+    Quantity volume = 0;
+    for (const auto& trade : trades) {
+        EXPECT_EQ(trade.getBidTrade().price_, equilibrium->price_);
+        EXPECT_EQ(trade.geAskTrade().price_, equilibrium->price_);
+        volume += trade.getBidTrade().quantity_;
+    }
+    EXPECT_EQ(volume, 35u);
+
+    // Order 1 bought first, order 2 is left with what the asks could not cover
+    auto bids = orderBook->GetOrderInfos().GetBids();
+    ASSERT_EQ(bids.size(), 1u);
+    EXPECT_EQ(bids[0].price_, 103);
+    EXPECT_EQ(bids[0].quantity_, 15u);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetAsks()[0].price_, 104);
+}
+
+// Test that market orders sweep the asks without ever resting, within the protection band when one is set
+TEST_F(OrderBookTest, MarketOrderSweepsWithoutResting) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 101, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Sell, 103, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 104, 10));
+
+    // Both sides of each trade report the price it executed at
+    auto trades = orderBook->AddOrder(std::make_shared<Order>(5, Side::Buy, 15));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[1].getBidTrade().price_, 101);
+    EXPECT_EQ(trades[1].geAskTrade().price_, 101);
+
+    // With a band of 2 ticks from 101 the ask at 104 is out of reach, the unfilled 5 is dropped
+    orderBook->SetMarketProtection(2);
+    trades = orderBook->AddOrder(std::make_shared<Order>(6, Side::Buy, 20));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[1].geAskTrade().price_, 103);
+    EXPECT_EQ(orderBook->Size(), 1u);
+    EXPECT_TRUE(orderBook->GetOrderInfos().GetBids().empty());
+}
+
+// Test that FillAndKill and FillOrKill orders trade at their own limit and never enter the book
+TEST_F(OrderBookTest, ImmediateOrdersNeverRest) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 102, 10));
+
+    auto fak = std::make_shared<Order>(OrderType::FillAndKill, 3, Side::Buy, 101, 15);
+    const auto trades = orderBook->AddOrder(fak);
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().price_, 101);
+    EXPECT_EQ(trades[0].geAskTrade().price_, 100);
+    EXPECT_EQ(fak->GetRemainingQuantity(), 5u);
+    EXPECT_TRUE(orderBook->GetOrderInfos().GetBids().empty());
+
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::FillOrKill, 4, Side::Buy, 102, 10));
+    EXPECT_EQ(orderBook->Size(), 0u);
+    EXPECT_EQ(orderBook->GetMetrics().restingOrders_.load(), 0u);
+}
+
+// Test that PruneGoodForDay cancels only the GoodForDay orders, and that the close is the next 4 pm
+TEST_F(OrderBookTest, PruneGoodForDayCancelsDayOrders) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodForDay, 1, Side::Buy, 99, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 98, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodForDay, 3, Side::Sell, 101, 10));
+
+    EXPECT_EQ(orderBook->PruneGoodForDay(), 2u);
+    EXPECT_EQ(orderBook->Size(), 1u);
+    EXPECT_EQ(orderBook->GetOrderInfos().GetBids()[0].price_, 98);
+    EXPECT_EQ(orderBook->GetMetrics().pruneRuns_.load(), 1u);
+    EXPECT_EQ(orderBook->PruneGoodForDay(), 0u);
+
+    const auto now = std::chrono::system_clock::now();
+    const auto close = OrderBook::NextGoodForDayClose(now);
+    EXPECT_GT(close, now);
+    EXPECT_LE(close - now, std::chrono::hours{25});
+    const auto closeTime = std::chrono::system_clock::to_time_t(close);
+    std::tm local;
+    localtime_r(&closeTime, &local);
+    EXPECT_EQ(local.tm_hour, 16);
+    // At the close itself the next one is a day later
+    EXPECT_GT(OrderBook::NextGoodForDayClose(close) - close, std::chrono::hours{22});
+}
+
+// Rests bids of the given sizes at 100 with ids 1..n, sells into them and returns how much each bid got
+template <typename Book>
+std::vector<Quantity> FillsOfRestingBids(Book& book, const std::vector<Quantity>& bids, Quantity sell)
+{
+    for (std::size_t i = 0; i < bids.size(); ++i)
+        book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, i + 1, Side::Buy, 100, bids[i]));
+
+    std::vector<Quantity> fills(bids.size());
+    for (const auto& trade : book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 99, Side::Sell, 100, sell)))
+        fills[trade.getBidTrade().orderId_ - 1] += trade.getBidTrade().quantity_;
+    return fills;
+}
+
+TEST(MatchingPolicyTest, ProRataSplitsBySize) {
+    ProRataOrderBook book;
+    EXPECT_EQ(FillsOfRestingBids(book, {10, 30, 60}, 50), (std::vector<Quantity>{5, 15, 30}));
+    EXPECT_EQ(book.GetOrderInfos().GetBids()[0].quantity_, 50u);
+}
+
+TEST(MatchingPolicyTest, ProRataDropsSharesUnderMinimum) {
+    // 0.3 of a lot is under the minimum of 2, the 9.7 rounds down and the leftover lot goes in time order
+    ProRataOrderBook book;
+    EXPECT_EQ(FillsOfRestingBids(book, {3, 97}, 10), (std::vector<Quantity>{1, 9}));
+}
+
+TEST(MatchingPolicyTest, TopOrderFillsFirstThenProRata) {
+    TopOrderProRataOrderBook book;
+    EXPECT_EQ(FillsOfRestingBids(book, {10, 30, 60}, 50), (std::vector<Quantity>{10, 14, 26}));
+}
+
+TEST(MatchingPolicyTest, ProRataUncrossSplitsTheLargerSide) {
+    // The ask arrived first, which would make the bids the aggressors, but they are the side that cannot all fill
+    ProRataOrderBook book;
+    book.BeginAuction();
+    book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 50));
+    const std::vector<Quantity> bids {10, 30, 60};
+    for (std::size_t i = 0; i < bids.size(); ++i)
+        book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, i + 2, Side::Buy, 100, bids[i]));
+
+    std::vector<Quantity> fills(bids.size());
+    for (const auto& trade : book.Uncross())
+        fills[trade.getBidTrade().orderId_ - 2] += trade.getBidTrade().quantity_;
+    EXPECT_EQ(fills, (std::vector<Quantity>{5, 15, 30}));
+}
+
+TEST(OrderBookTraitsTest, WideBookTakes64BitPricesAndQuantities) {
+    using Order = WideOrderBook::Order;
+    WideOrderBook book;
+    constexpr WideOrderBook::Price price = 5'000'000'000;
+    constexpr WideOrderBook::Quantity quantity = 6'000'000'000;
+
+    book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, price, quantity));
+    const auto trades = book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, price, quantity - 1));
+
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].getBidTrade().price_, price);
+    EXPECT_EQ(trades[0].getBidTrade().quantity_, quantity - 1);
+    EXPECT_EQ(book.GetOrderInfos().GetAsks()[0].quantity_, 1u);
+}
+
+TEST(OrderBookTraitsTest, LadderBookMatchesLikeTheTree) {
+    LadderOrderBook book;
+    book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 105, 10));
+    book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 101, 10));
+    book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 99, 10));
+    book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 97, 10));
+
+    // A market buy sweeps both asks, best price first
+    const auto trades = book.AddOrder(std::make_shared<Order>(5, Side::Buy, 15));
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].geAskTrade().price_, 101);
+    EXPECT_EQ(trades[1].geAskTrade().price_, 105);
+
+    book.CancelOrder(3);
+    EXPECT_EQ(book.GetOrderInfos().GetBids()[0].price_, 97);
+
+    // Prices outside the ladder are rejected instead of resting
+    EXPECT_TRUE(book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 6, Side::Sell, 70000, 10)).empty());
+    EXPECT_EQ(book.Size(), 2u);
+}
+
+TEST(HugePageArenaTest, RecyclesBlocksAndFallsBackWhenFull) {
+    HugePageArena arena{HugePageArena::HugePageSize, true};
+    if (arena.GetBacking() == HugePageArena::Backing::None)
+        GTEST_SKIP() << "no anonymous mappings here";
+
+    // 40 and 48 bytes share a size class, so the freed block is handed out again
+    auto* block = arena.Allocate(40);
+    arena.Deallocate(block, 40);
+    EXPECT_EQ(arena.Allocate(48), block);
+
+    // More than is left comes from operator new and goes back there
+    auto* large = arena.Allocate(HugePageArena::HugePageSize);
+    EXPECT_EQ(arena.Used(), 48u);
+    arena.Deallocate(large, HugePageArena::HugePageSize);
+}
+
+// Built before anything touches the default arena, so it is destroyed after the arena would be if the arena
+// were an ordinary static. The test binary then crashes at exit
+HugePageOrderBook staticHugePageBook;
+
+TEST(OrderBookTraitsTest, StaticHugePageBookFreesIntoTheArenaAtExit) {
+    staticHugePageBook.SetMarketProtection(5);
+    staticHugePageBook.AddOrder(HugePageOrderBook::MakeOrder(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+    EXPECT_EQ(staticHugePageBook.Size(), 1u);
+}
+
+TEST(OrderBookTraitsTest, HugePageBookMakesItsOwnOrders) {
+    HugePageOrderBook book;
+    book.AddOrder(HugePageOrderBook::MakeOrder(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+    EXPECT_EQ(book.AddOrder(HugePageOrderBook::MakeOrder(OrderType::GoodTillCancel, 2, Side::Buy, 100, 4)).size(), 1u);
+    EXPECT_EQ(book.GetOrderInfos().GetAsks()[0].quantity_, 6u);
+
+    // A replaced order is made with the book's allocator as well
+    book.Match(HugePageOrderBook::OrderModify{1, Side::Sell, 101, 8});
+    EXPECT_EQ(book.GetOrderInfos().GetAsks()[0].price_, 101);
+    EXPECT_EQ(book.GetOrderInfos().GetAsks()[0].quantity_, 8u);
+}
+
+TEST(MatchingLoopTest, RunsEveryTaskOnItsThread) {
+    MatchingLoop loop{MatchingLoopOptions{std::nullopt, 1000, 10}};
+    OrderBook book;
+
+    std::thread::id loopThread;
+    loop.Run([&] { loopThread = std::this_thread::get_id(); });
+    EXPECT_NE(loopThread, std::this_thread::get_id());
+
+    const auto trades = loop.Run([&] {
+        EXPECT_EQ(std::this_thread::get_id(), loopThread);
+        book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+        return book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 100, 10));
+    });
+    EXPECT_EQ(trades.size(), 1u);
+
+    EXPECT_THROW(loop.Run([]() -> int { throw std::logic_error("rejected"); }), std::logic_error);
+    EXPECT_EQ(loop.WakeupLatency().count_.load(), 3u);
+}
+
+TEST(MatchingLoopTest, CopiesOrderSnapshotsBackToTheCaller) {
+    MatchingLoop loop;
+    OrderBook book;
+    loop.Run([&book] {
+        book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Buy, 100, 10));
+        book.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 101, 5));
+    });
+
+    // As the gRPC handler does: a buffer of the calling thread, filled on the loop thread and grown in between
+    std::vector<OrderSnapshot> orders;
+    std::size_t count = 0;
+    std::thread caller([&] {
+        while ((count = loop.Run([&orders, &book] { return book.GetOrderSnapshot(orders.data(), orders.size()); })) > orders.size())
+            orders.resize(count);
+    });
+    caller.join();
+
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(orders[0].orderId_, 1u);
+    EXPECT_EQ(orders[0].price_, 100);
+    EXPECT_EQ(orders[0].quantity_, 10u);
+    EXPECT_EQ(orders[1].orderId_, 2u);
+    EXPECT_EQ(orders[1].side_, Side::Sell);
+}
+
+TEST(ShmGatewayTest, ServesRequestsOnTheMatchingThread) {
+    const auto name = "orderbook-test-" + std::to_string(getpid());
+    OrderBook book;
+    ShmGateway gateway{name, 1, [&book](const GatewayRequest& request, GatewayResponse& response) {
+        ServeGatewayRequest(book, request, response);
+    }};
+    MatchingLoop loop{MatchingLoopOptions{std::nullopt, 1000, 10}};
+    loop.SetPoller([&gateway] { return gateway.Poll(); });
+
+    ShmGatewayClient client{ShmGateway::SegmentName(name, 0)};
+    EXPECT_THROW(ShmGatewayClient{ShmGateway::SegmentName(name, 0)}, std::runtime_error);
+
+    OrderEntry entry;
+    entry.orderId_ = 1;
+    entry.side_ = Side::Sell;
+    entry.price_ = 100;
+    entry.quantity_ = 10;
+    ASSERT_TRUE(client.TrySend(MakeAddRequest(1, entry)));
+    entry.orderId_ = 2;
+    entry.side_ = Side::Buy;
+    entry.quantity_ = 4;
+    ASSERT_TRUE(client.TrySend(MakeAddRequest(2, entry)));
+    entry.orderId_ = 3;
+    entry.quantity_ = 0; // Rejected like it would be over gRPC
+    ASSERT_TRUE(client.TrySend(MakeAddRequest(3, entry)));
+
+    std::vector<GatewayResponse> responses;
+    GatewayResponse response;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (responses.size() < 3 && std::chrono::steady_clock::now() < deadline) {
+        if (client.TryReceive(response))
+            responses.push_back(response);
+        else
+            std::this_thread::yield();
+    }
+
+    ASSERT_EQ(responses.size(), 3u);
+    EXPECT_EQ(responses[0].status_, static_cast<std::uint8_t>(GatewayStatus::Accepted));
+    EXPECT_EQ(responses[1].sequence_, 2u);
+    EXPECT_EQ(responses[1].filledQuantity_, 4u);
+    EXPECT_EQ(responses[2].status_, static_cast<std::uint8_t>(GatewayStatus::Rejected));
+    EXPECT_STREQ(responses[2].text_, "Quantity must be positive");
+    EXPECT_EQ(loop.Run([&] { return book.GetOrderInfos(); }).GetAsks()[0].quantity_, 6u);
+}
+
+TEST(TcpGatewayTest, SequencesSessionsAndClosesOnAGap) {
+    OrderBook book;
+    // Only the listener thread calls the handler, so it can own the book here
+    TcpGateway gateway{0, [&book](const GatewayRequest* requests, GatewayResponse* responses, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i)
+            ServeGatewayRequest(book, requests[i], responses[i]);
+    }};
+    TcpGatewayClient client{"127.0.0.1", gateway.Port()};
+
+    OrderEntry entry;
+    entry.orderId_ = 1;
+    entry.side_ = Side::Sell;
+    entry.price_ = 100;
+    entry.quantity_ = 10;
+    EXPECT_EQ(client.Send(MakeAddRequest(0, entry)), 1u);
+    entry.orderId_ = 2;
+    entry.side_ = Side::Buy;
+    entry.quantity_ = 4;
+    EXPECT_EQ(client.Send(MakeAddRequest(0, entry)), 2u);
+    entry.orderId_ = 3;
+    client.SendRaw(MakeAddRequest(7, entry)); // Skips 3 to 6
+
+    SequencedResponse response;
+    ASSERT_TRUE(client.Receive(response));
+    EXPECT_EQ(response.sessionSequence_, 1u);
+    EXPECT_EQ(response.response_.status_, static_cast<std::uint8_t>(GatewayStatus::Accepted));
+    ASSERT_TRUE(client.Receive(response));
+    EXPECT_EQ(response.response_.sequence_, 2u);
+    EXPECT_EQ(response.response_.filledQuantity_, 4u);
+    ASSERT_TRUE(client.Receive(response));
+    EXPECT_EQ(response.sessionSequence_, 3u);
+    EXPECT_EQ(response.response_.status_, static_cast<std::uint8_t>(GatewayStatus::Rejected));
+    EXPECT_STREQ(response.response_.text_, "Expected sequence 3");
+    EXPECT_FALSE(client.Receive(response));
+}
+
+// Test that book events come out as ITCH messages, numbered without gaps across flushes
+TEST_F(OrderBookTest, MarketDataEncodesBookEvents) {
+    std::vector<std::vector<std::uint8_t>> messages;
+    std::uint64_t nextSequence = 1;
+    ItchEncoder encoder{7, "TEST", 2 * Itch::MaxFrameSize, [&](std::uint64_t firstSequence, std::size_t count,
+        const std::uint8_t* data, std::size_t size) {
+        EXPECT_EQ(firstSequence, nextSequence);
+        nextSequence += count;
+        for (std::size_t offset = 0; offset < size; offset += 2 + Itch::ReadU16(data + offset))
+            messages.emplace_back(data + offset + 2, data + offset + 2 + Itch::ReadU16(data + offset));
+    }};
+    orderBook->SetMarketDataEncoder(&encoder);
+
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 100, 4));
+    orderBook->Match(OrderModify{1, Side::Sell, 100, 3});
+    orderBook->CancelOrder(1);
+    encoder.Flush();
+    orderBook->SetMarketDataEncoder(nullptr);
+
+    std::string types;
+    for (const auto& message : messages)
+        types += static_cast<char>(message[0]);
+    // The buy fills on arrival, so it is never added and only the resting sell reports the execution
+    ASSERT_EQ(types, "RAPEXD");
+    EXPECT_EQ(nextSequence, 7u);
+
+    const auto& add = messages[1];
+    EXPECT_EQ(Itch::ReadU16(add.data() + 1), 7u);
+    EXPECT_EQ(Itch::ReadU64(add.data() + 11), 1u);
+    EXPECT_EQ(add[19], 'S');
+    EXPECT_EQ(Itch::ReadU32(add.data() + 20), 10u);
+    EXPECT_EQ(std::string(add.begin() + 24, add.begin() + 32), "TEST    ");
+    EXPECT_EQ(Itch::ReadU32(add.data() + 32), 10000u); // 100 cents with 4 decimals
+
+    // The trade names the resting sell, the execution carries its match number
+    const auto& trade = messages[2];
+    EXPECT_EQ(Itch::ReadU64(trade.data() + 11), 1u);
+    EXPECT_EQ(trade[19], 'S');
+    EXPECT_EQ(Itch::ReadU32(trade.data() + 20), 4u);
+    EXPECT_EQ(Itch::ReadU64(trade.data() + 36), 1u);
+    EXPECT_EQ(Itch::ReadU64(messages[3].data() + 11), 1u);
+    EXPECT_EQ(Itch::ReadU64(messages[3].data() + 23), 1u);
+    EXPECT_EQ(Itch::ReadU32(messages[4].data() + 19), 3u); // Amended from 6 open to 3
+}
+
+// Test that a price past the ITCH price field throws instead of wrapping, and leaves no message behind
+TEST(ItchEncoderTest, RejectsPricesTheFieldCannotHold) {
+    std::size_t encoded = 0;
+    ItchEncoder encoder{1, "WIDE", 1 << 12, [&encoded](std::uint64_t, std::size_t count, const std::uint8_t*, std::size_t) {
+        encoded += count;
+    }};
+    const auto next = encoder.NextSequence();
+
+    EXPECT_THROW(encoder.AddOrder(1, Side::Buy, 10, 50'000'000), std::out_of_range); // 5e9 ten-thousandths
+    EXPECT_THROW(encoder.Trade(1, Side::Sell, 10, -1), std::out_of_range);
+    EXPECT_EQ(encoder.NextSequence(), next);
+    EXPECT_EQ(encoder.MatchNumber(), 0u);
+
+    encoder.AddOrder(2, Side::Buy, 10, 42'949'672); // The largest price in cents that fits
+    encoder.Flush();
+    EXPECT_EQ(encoded, 2u); // The stock directory and the add
+}
+
+// Test that replaying the book's own feed rebuilds the same book, through iceberg reloads and sweeps
+TEST_F(OrderBookTest, TradeTapeKeepsTheLastTrades) {
+    EXPECT_THROW(TradeTape{3}, std::invalid_argument);
+
+    TradeTape tape{4};
+    orderBook->SetTradeTape(&tape);
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 101, 3));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 102, 3));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 102, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Sell, 100, 1));
+
+    // At the resting price, with the side that crossed
+    TradeRecord trades[4];
+    ASSERT_EQ(tape.Read(0, 4, trades), 3u);
+    EXPECT_EQ(trades[0].sequence_, 1u);
+    EXPECT_EQ(trades[0].price_, 101);
+    EXPECT_EQ(trades[0].quantity_, 3u);
+    EXPECT_EQ(trades[0].aggressor_, Side::Buy);
+    EXPECT_EQ(trades[1].price_, 102);
+    EXPECT_EQ(trades[1].quantity_, 3u);
+    EXPECT_EQ(trades[2].price_, 102);
+    EXPECT_EQ(trades[2].aggressor_, Side::Sell);
+    EXPECT_GE(trades[2].timestamp_, trades[0].timestamp_);
+
+    // Reads resume after a sequence and stop at limit
+    ASSERT_EQ(tape.Read(1, 1, trades), 1u);
+    EXPECT_EQ(trades[0].sequence_, 2u);
+
+    // Once the ring wraps the oldest trades are gone and a late reader sees the gap
+    for (OrderId id = 5; id < 8; ++id)
+        orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, id, Side::Sell, 100, 1));
+    EXPECT_EQ(tape.LastSequence(), 6u);
+    ASSERT_EQ(tape.Read(0, 4, trades), 4u);
+    EXPECT_EQ(trades[0].sequence_, 3u);
+    EXPECT_EQ(trades[3].sequence_, 6u);
+    orderBook->SetTradeTape(nullptr);
+}
+
+TEST(BarAggregatorTest, RollsTradesIntoBars) {
+    using namespace std::chrono;
+    constexpr std::uint64_t Second = 1'000'000'000;
+    EXPECT_THROW(BarAggregator({}), std::invalid_argument);
+
+    BarAggregator bars{{seconds{1}, minutes{1}}, 2};
+    bars.OnTrade(60 * Second + Second / 5, 100, 10);
+    bars.OnTrade(60 * Second + Second / 2, 104, 5);
+    bars.OnTrade(60 * Second + Second * 9 / 10, 98, 5);
+    // The first trade of the next second finalizes the first bar
+    bars.OnTrade(61 * Second + Second / 10, 101, 20);
+
+    auto perSecond = bars.GetBars(seconds{1}, 10);
+    ASSERT_EQ(perSecond.size(), 1u);
+    EXPECT_EQ(perSecond[0].start_, 60 * Second);
+    EXPECT_EQ(std::make_tuple(perSecond[0].open_, perSecond[0].high_, perSecond[0].low_, perSecond[0].close_), std::make_tuple(100, 104, 98, 98));
+    EXPECT_EQ(perSecond[0].volume_, 20u);
+    EXPECT_EQ(perSecond[0].trades_, 3u);
+    EXPECT_DOUBLE_EQ(perSecond[0].Vwap(), (100.0 * 10 + 104 * 5 + 98 * 5) / 20);
+
+    // The minute is still open, until the clock passes its end
+    EXPECT_TRUE(bars.GetBars(minutes{1}, 10).empty());
+    ASSERT_TRUE(bars.GetOpenBar(minutes{1}));
+    EXPECT_EQ(bars.GetOpenBar(minutes{1})->volume_, 40u);
+    bars.Advance(120 * Second);
+    EXPECT_FALSE(bars.GetOpenBar(minutes{1}));
+    ASSERT_EQ(bars.GetBars(minutes{1}, 10).size(), 1u);
+    EXPECT_EQ(bars.GetBars(minutes{1}, 10)[0].close_, 101);
+
+    // Only the last two bars are kept
+    bars.OnTrade(130 * Second, 102, 1);
+    bars.Advance(200 * Second);
+    perSecond = bars.GetBars(seconds{1}, 10);
+    ASSERT_EQ(perSecond.size(), 2u);
+    EXPECT_EQ(perSecond[0].start_, 61 * Second);
+    EXPECT_EQ(perSecond[1].start_, 130 * Second);
+    EXPECT_THROW(bars.GetBars(minutes{5}, 1), std::invalid_argument);
+
+    // A book feeds the open bars with its trades
+    OrderBook orderBook;
+    BarAggregator bookBars{{hours{24}}};
+    orderBook.SetBarAggregator(&bookBars);
+    orderBook.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 101, 3));
+    orderBook.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Buy, 102, 2));
+    ASSERT_TRUE(bookBars.GetOpenBar(hours{24}));
+    EXPECT_EQ(bookBars.GetOpenBar(hours{24})->close_, 101);
+    EXPECT_EQ(bookBars.GetOpenBar(hours{24})->volume_, 2u);
+    orderBook.SetBarAggregator(nullptr);
+}
+
+TEST(FeedHandlerTest, RebuildsTheBookFromItsFeed) {
+    std::vector<std::uint8_t> feed;
+    OrderBook source;
+    ItchEncoder encoder{3, "SRC", 1 << 12, [&feed](std::uint64_t, std::size_t, const std::uint8_t* data, std::size_t size) {
+        feed.insert(feed.end(), data, data + size);
+    }};
+    source.SetMarketDataEncoder(&encoder);
+
+    source.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 101, 10));
+    source.AddOrder(std::make_shared<Order>(2, Side::Sell, 100, 30, 5)); // Iceberg showing 5
+    source.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 98, 20));
+    source.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4, Side::Buy, 97, 20));
+    source.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 5, Side::Buy, 100, 12)); // Takes two tranches
+    source.AddOrder(std::make_shared<Order>(OrderType::FillAndKill, 6, Side::Sell, 97, 25));
+    source.Match(OrderModify{4, Side::Buy, 97, 9});
+    source.CancelOrder(1);
+    source.AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 7, Side::Sell, 102, 8));
+    source.SetMarketDataEncoder(nullptr);
+    encoder.Flush();
+
+    FeedHandler handler;
+    EXPECT_EQ(handler.Apply(feed.data(), feed.size()), feed.size());
+    const auto* symbol = handler.FindSymbol("SRC");
+    ASSERT_NE(symbol, nullptr);
+
+    const auto expected = source.GetOrderInfos();
+    const auto rebuilt = symbol->book_->GetOrderInfos();
+    auto Levels = [](const LevelInfos& levels) {
+        std::vector<std::pair<Price, Quantity>> result;
+        for (const auto& level : levels)
+            result.emplace_back(level.price_, level.quantity_);
+        return result;
+    };
+    EXPECT_EQ(Levels(rebuilt.GetBids()), Levels(expected.GetBids()));
+    EXPECT_EQ(Levels(rebuilt.GetAsks()), Levels(expected.GetAsks()));
+
+    const auto& statistics = handler.GetStatistics();
+    EXPECT_EQ(statistics.unknownOrders_, 0u);
+    EXPECT_EQ(statistics.duplicateOrders_, 0u);
+    EXPECT_EQ(statistics.crossedShares_, 0u); // The feed never crosses
+    EXPECT_EQ(statistics.malformed_, 0u);
+
+    // A replace, which the engine does not send but exchanges do: bid 4 moves up to 99 as order 40
+    std::uint8_t replace[2 + Itch::OrderReplaceSize] = {};
+    Itch::WriteU16(replace, Itch::OrderReplaceSize);
+    replace[2] = 'U';
+    Itch::WriteU16(replace + 3, 3);
+    Itch::WriteU64(replace + 13, 4);
+    Itch::WriteU64(replace + 21, 40);
+    Itch::WriteU32(replace + 29, 6);
+    Itch::WriteU32(replace + 33, 9900);
+    handler.Apply(replace, sizeof(replace));
+    EXPECT_EQ(handler.GetStatistics().replaces_, 1u);
+    const auto bids = symbol->book_->GetOrderInfos().GetBids();
+    ASSERT_FALSE(bids.empty());
+    EXPECT_EQ(bids[0].price_, 99);
+    EXPECT_EQ(bids[0].quantity_, 6u);
+}
+
+// Test that prices between two ticks are counted and rounded away from the spread instead of crossing the book
+TEST(FeedHandlerTest, RoundsSubTickPricesAwayFromTheSpread) {
+    auto Add = [](OrderId orderId, char side, std::uint32_t price) {
+        std::vector<std::uint8_t> frame(2 + Itch::AddOrderSize);
+        Itch::WriteU16(frame.data(), Itch::AddOrderSize);
+        frame[2] = 'A';
+        Itch::WriteU16(frame.data() + 3, 5);
+        Itch::WriteU64(frame.data() + 13, orderId);
+        frame[21] = static_cast<std::uint8_t>(side);
+        Itch::WriteU32(frame.data() + 22, 10);
+        std::memcpy(frame.data() + 26, "SUB     ", 8);
+        Itch::WriteU32(frame.data() + 34, price);
+        return frame;
+    };
+
+    FeedHandler handler;
+    for (const auto& frame : {Add(1, 'B', 10040), Add(2, 'S', 10060), Add(3, 'B', 9900)})
+        handler.Apply(frame.data(), frame.size());
+
+    const auto* symbol = handler.FindSymbol("SUB");
+    ASSERT_NE(symbol, nullptr);
+    const auto infos = symbol->book_->GetOrderInfos();
+    ASSERT_EQ(infos.GetBids().size(), 2u);
+    ASSERT_EQ(infos.GetAsks().size(), 1u);
+    EXPECT_EQ(infos.GetBids()[0].price_, 100);
+    EXPECT_EQ(infos.GetAsks()[0].price_, 101);
+    EXPECT_EQ(handler.GetStatistics().subTickPrices_, 2u);
+    EXPECT_EQ(handler.GetStatistics().crossedShares_, 0u);
+}
+
+// Test that counters and gauges follow adds, trades, cancels and rejections
+TEST(BacktestRunnerTest, ReplaysEveryFileOnItsOwnBook) {
+    auto Add = [](std::uint64_t sequence, OrderId orderId, Side side, Price price, Quantity quantity) {
+        OrderEntry entry;
+        entry.orderId_ = orderId;
+        entry.side_ = side;
+        entry.price_ = price;
+        entry.quantity_ = quantity;
+        return MakeAddRequest(sequence, entry);
+    };
+
+    const std::string crossing = testing::TempDir() + "order_book_backtest_AAA.flow";
+    OrderFlowWriter first{crossing, "AAA", 20260105};
+    first.Append(Add(1, 1, Side::Sell, 101, 5));
+    first.Append(Add(2, 2, Side::Buy, 101, 3));
+    first.Append(MakeCancelRequest(3, 1));
+    first.Close();
+
+    // Same order ids as the first file, the books are independent
+    const std::string resting = testing::TempDir() + "order_book_backtest_BBB.flow";
+    OrderFlowWriter second{resting, "BBB", 20260106};
+    second.Append(Add(1, 1, Side::Buy, 100, 0));
+    second.Append(Add(2, 2, Side::Buy, 102, 4));
+    second.Close();
+
+    const std::string missing = testing::TempDir() + "order_book_backtest_missing.flow";
+    const auto summary = BacktestRunner{2}.Run({crossing, resting, missing});
+    ASSERT_EQ(summary.results_.size(), 3u);
+
+    const auto& a = summary.results_[0];
+    EXPECT_EQ(a.symbol_, "AAA");
+    EXPECT_EQ(a.date_, 20260105u);
+    EXPECT_EQ(std::make_tuple(a.requests_, a.trades_, a.filledQuantity_, a.rejected_, a.restingOrders_),
+        std::make_tuple(3ull, 1ull, 3ull, 0ull, std::size_t{0}));
+
+    const auto& b = summary.results_[1];
+    EXPECT_EQ(b.symbol_, "BBB");
+    EXPECT_EQ(std::make_tuple(b.requests_, b.trades_, b.rejected_, b.restingOrders_), std::make_tuple(2ull, 0ull, 1ull, std::size_t{1}));
+    EXPECT_TRUE(summary.results_[2].error_.find("Cannot open") != std::string::npos);
+
+    EXPECT_EQ(summary.requests_, 5u);
+    EXPECT_EQ(summary.trades_, 1u);
+    EXPECT_EQ(summary.rejected_, 1u);
+    EXPECT_EQ(summary.failed_, 1u);
+    std::remove(crossing.c_str());
+    std::remove(resting.c_str());
+}
+
+TEST_F(OrderBookTest, MetricsTrackEngineActivity) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 1, Side::Sell, 100, 50));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 2, Side::Sell, 105, 30));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 3, Side::Buy, 95, 10));
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::FillOrKill, 4, Side::Buy, 100, 60)); // Rejected
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::FillAndKill, 5, Side::Buy, 100, 20));
+    orderBook->CancelOrder(3);
+
+    const auto& metrics = orderBook->GetMetrics();
+    EXPECT_EQ(metrics.ordersAdded_[EngineMetrics::Index(OrderType::GoodTillCancel)].load(), 3u);
+    EXPECT_EQ(metrics.ordersAdded_[EngineMetrics::Index(OrderType::FillAndKill)].load(), 1u);
+    EXPECT_EQ(metrics.ordersRejected_[EngineMetrics::Index(OrderType::FillOrKill)].load(), 1u);
+    EXPECT_EQ(metrics.trades_.load(), 1u);
+    EXPECT_EQ(metrics.ordersCancelled_.load(), 1u);
+    EXPECT_EQ(metrics.restingOrders_.load(), 2u);
+    EXPECT_EQ(metrics.bidLevels_.load(), 0u);
+    EXPECT_EQ(metrics.askLevels_.load(), 2u);
+    EXPECT_GT(metrics.memoryBytes_.load(), 0u);
+
+    const auto text = RenderMetrics(metrics);
+    EXPECT_NE(text.find("orderbook_orders_added_total{type=\"GoodTillCancel\"} 3"), std::string::npos);
+    EXPECT_NE(text.find("orderbook_resting_orders 2"), std::string::npos);
+}
+
+#ifdef ORDERBOOK_ENABLE_TRACE
+// Test that engine events end up in the trace dump
+TEST_F(OrderBookTest, TraceDumpContainsEngineEvents) {
+    orderBook->AddOrder(std::make_shared<Order>(OrderType::GoodTillCancel, 4242, Side::Buy, 100, 10));
+    orderBook->CancelOrder(4242);
+
+    const std::string path = testing::TempDir() + "order_book_trace_test.bin";
+    ASSERT_TRUE(Tracer::Dump(path.c_str()));
+
+    std::ifstream input(path, std::ios::binary);
+    TraceFileHeader header {};
+    ASSERT_TRUE(input.read(reinterpret_cast<char*>(&header), sizeof(header)));
+    EXPECT_EQ(header.magic_, TraceFileMagic);
+    ASSERT_GE(header.ringCount_, 1u);
+
+    bool sawAdd = false, sawCancel = false, sawLevelErase = false;
+    for (std::uint32_t ring = 0; ring < header.ringCount_; ++ring) {
+        TraceRingHeader ringHeader {};
+        ASSERT_TRUE(input.read(reinterpret_cast<char*>(&ringHeader), sizeof(ringHeader)));
+        std::vector<TraceEvent> events(ringHeader.count_);
+        ASSERT_TRUE(input.read(reinterpret_cast<char*>(events.data()), events.size() * sizeof(TraceEvent)));
+
+        for (const auto& event : events) {
+            sawAdd |= event.type_ == TraceEventType::OrderAdded && event.orderId_ == 4242;
+            sawCancel |= event.type_ == TraceEventType::OrderCancelled && event.orderId_ == 4242;
+            sawLevelErase |= event.type_ == TraceEventType::LevelErased && event.price_ == 100;
+        }
+    }
+    std::remove(path.c_str());
+
+    EXPECT_TRUE(sawAdd);
+    EXPECT_TRUE(sawCancel);
+    EXPECT_TRUE(sawLevelErase);
+}
+#endif
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,275 @@
+#pragma once
+#include "types.hpp"
+#include "matching_policy.hpp"
+#include "huge_page_arena.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Compile-time configuration of BasicOrderBook. A traits type names:
+ *   Price, Quantity       integer widths of prices and quantities
+ *   Allocator<T>          allocator of the book's node based containers
+ *   LevelStore<K, V, C>   the price levels of one side, iterated from the best price (C order) like a std::map
+ *   OrderIndex<V>         orders by id
+ *   Matching              the level allocation rule, see matching_policy.hpp
+ * Derive from DefaultOrderBookTraits and override what differs. LevelStore and OrderIndex use the Allocator
+ * of the traits they are declared in, so a traits type changing Allocator redeclares them too.
+ */
+
+// Price levels in a flat array with one slot per price in [LowestPrice, HighestPrice], for instruments whose
+// prices stay inside a known band. Finding or creating a level is an index instead of a tree walk, at the cost
+// of memory for every slot up front. Iterates from the best price like the std::map it replaces
+template <typename Key, typename Value, typename Compare, std::int64_t LowestPrice, std::int64_t HighestPrice>
+class LadderLevelStore
+{
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<const Key, Value>;
+        using size_type = std::size_t;
+
+    private:
+        static_assert(LowestPrice <= HighestPrice, "Empty ladder");
+
+        static constexpr std::size_t Slots = static_cast<std::size_t>(HighestPrice - LowestPrice) + 1;
+        // Slots are kept in iteration order, rank 0 holds the best price the ladder can take
+        static constexpr bool Descending = std::is_same_v<Compare, std::greater<Key>>;
+
+        std::vector<std::optional<value_type>> slots_ = std::vector<std::optional<value_type>>(Slots);
+        std::size_t size_ {};
+        std::size_t best_ {Slots}; // First occupied rank, Slots when empty
+        std::size_t worst_ {};     // Last occupied rank
+
+        static std::size_t Rank(Key price)
+        {
+            return static_cast<std::size_t>(Descending ? HighestPrice - price : price - LowestPrice);
+        }
+
+        std::size_t Next(std::size_t rank) const
+        {
+            while (++rank <= worst_ && !slots_[rank]) {}
+            return rank > worst_ ? Slots : rank;
+        }
+
+        std::size_t Previous(std::size_t rank) const
+        {
+            if (rank == Slots)
+                return worst_;
+            while (!slots_[--rank]) {}
+            return rank;
+        }
+
+        template <bool IsConst>
+        class Iterator
+        {
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = LadderLevelStore::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+                using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+                using Store = std::conditional_t<IsConst, const LadderLevelStore, LadderLevelStore>;
+
+                Iterator() = default;
+                Iterator(Store* store, std::size_t rank) : store_{store}, rank_{rank} {}
+                // iterator converts to const_iterator
+                template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+                Iterator(const Iterator<OtherConst>& other) : store_{other.store_}, rank_{other.rank_} {}
+
+                reference operator*() const { return *store_->slots_[rank_]; }
+                pointer operator->() const { return &*store_->slots_[rank_]; }
+
+                Iterator& operator++() { rank_ = store_->Next(rank_); return *this; }
+                Iterator operator++(int) { auto copy = *this; ++*this; return copy; }
+                Iterator& operator--() { rank_ = store_->Previous(rank_); return *this; }
+                Iterator operator--(int) { auto copy = *this; --*this; return copy; }
+
+                bool operator==(const Iterator& other) const { return rank_ == other.rank_; }
+                bool operator!=(const Iterator& other) const { return rank_ != other.rank_; }
+
+            private:
+                friend class LadderLevelStore;
+                template <bool> friend class Iterator;
+
+                Store* store_ {};
+                std::size_t rank_ {Slots};
+        };
+
+    public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        // Prices outside the ladder cannot rest, the book rejects orders at them
+        static bool Holds(Key price) { return price >= LowestPrice && price <= HighestPrice; }
+
+        bool empty() const { return size_ == 0; }
+        std::size_t size() const { return size_; }
+
+        iterator begin() { return {this, best_}; }
+        iterator end() { return {this, Slots}; }
+        const_iterator begin() const { return {this, best_}; }
+        const_iterator end() const { return {this, Slots}; }
+
+        Value& operator[](Key price)
+        {
+            if (!Holds(price))
+                throw std::out_of_range("Price " + std::to_string(price) + " is outside the ladder");
+
+            const auto rank = Rank(price);
+            auto& slot = slots_[rank];
+            if (!slot) {
+                slot.emplace(std::piecewise_construct, std::forward_as_tuple(price), std::forward_as_tuple());
+                best_ = size_ == 0 ? rank : std::min(best_, rank);
+                worst_ = size_ == 0 ? rank : std::max(worst_, rank);
+                ++size_;
+            }
+            return slot->second;
+        }
+
+        Value& at(Key price)
+        {
+            if (!Holds(price) || !slots_[Rank(price)])
+                throw std::out_of_range("No level at price " + std::to_string(price));
+            return slots_[Rank(price)]->second;
+        }
+
+        iterator find(Key price)
+        {
+            return Holds(price) && slots_[Rank(price)] ? iterator{this, Rank(price)} : end();
+        }
+
+        const_iterator find(Key price) const
+        {
+            return Holds(price) && slots_[Rank(price)] ? const_iterator{this, Rank(price)} : end();
+        }
+
+        iterator erase(iterator position)
+        {
+            const auto rank = position.rank_;
+            const auto next = Next(rank);
+            slots_[rank].reset();
+
+            if (--size_ == 0) {
+                best_ = Slots;
+                worst_ = 0;
+            }
+            else {
+                if (rank == best_)
+                    best_ = next;
+                if (rank == worst_)
+                    worst_ = Previous(rank);
+            }
+            return {this, next};
+        }
+
+        std::size_t erase(Key price)
+        {
+            const auto position = find(price);
+            if (position == end())
+                return 0;
+            erase(position);
+            return 1;
+        }
+};
+
+// 32-bit prices and quantities, levels in a red-black tree, orders in a hash table, std::allocator, FIFO matching
+struct DefaultOrderBookTraits {
+    using Price = ::Price;
+    using Quantity = ::Quantity;
+
+    template <typename T>
+    using Allocator = std::allocator<T>;
+
+    template <typename Key, typename Value, typename Compare>
+    using LevelStore = std::map<Key, Value, Compare, Allocator<std::pair<const Key, Value>>>;
+
+    template <typename Value>
+    using OrderIndex = std::unordered_map<OrderId, Value, std::hash<OrderId>, std::equal_to<OrderId>,
+        Allocator<std::pair<const OrderId, Value>>>;
+
+    using Matching = FifoMatching;
+};
+
+// Default book with another level allocation rule
+template <typename Policy>
+struct MatchingTraits : DefaultOrderBookTraits {
+    using Matching = Policy;
+};
+
+// 64-bit prices and quantities, for instruments quoted in very fine ticks or traded in sizes over 2^32,
+// such as crypto pairs
+struct WideOrderBookTraits : DefaultOrderBookTraits {
+    using Price = std::int64_t;
+    using Quantity = std::uint64_t;
+};
+
+// Price levels in a LadderLevelStore over [LowestPrice, HighestPrice]
+template <std::int64_t LowestPrice, std::int64_t HighestPrice>
+struct LadderOrderBookTraits : DefaultOrderBookTraits {
+    template <typename Key, typename Value, typename Compare>
+    using LevelStore = LadderLevelStore<Key, Value, Compare, LowestPrice, HighestPrice>;
+};
+
+// Orders indexed in a tree: lookups are log n but there is never a rehash on the add path
+struct TreeIndexOrderBookTraits : DefaultOrderBookTraits {
+    template <typename Value>
+    using OrderIndex = std::map<OrderId, Value, std::less<OrderId>, Allocator<std::pair<const OrderId, Value>>>;
+};
+
+// Every node based container of the book, and the orders made with MakeOrder, in HugePageArena::Default()
+struct HugePageOrderBookTraits : DefaultOrderBookTraits {
+    template <typename T>
+    using Allocator = HugePageAllocator<T>;
+
+    template <typename Key, typename Value, typename Compare>
+    using LevelStore = std::map<Key, Value, Compare, Allocator<std::pair<const Key, Value>>>;
+
+    template <typename Value>
+    using OrderIndex = std::unordered_map<OrderId, Value, std::hash<OrderId>, std::equal_to<OrderId>,
+        Allocator<std::pair<const OrderId, Value>>>;
+};
+
+namespace detail {
+    template <typename Store, typename Key, typename = void>
+    struct HasHolds : std::false_type {};
+    template <typename Store, typename Key>
+    struct HasHolds<Store, Key, std::void_t<decltype(Store::Holds(std::declval<Key>()))>> : std::true_type {};
+
+    // Whether store can take a level at price. Only bounded stores like the ladder can refuse one
+    template <typename Store, typename Key>
+    bool StoreHolds(Key price)
+    {
+        if constexpr (HasHolds<Store, Key>::value)
+            return Store::Holds(price);
+        else
+            return true;
+    }
+
+    template <typename Container, typename = void>
+    struct HasBuckets : std::false_type {};
+    template <typename Container>
+    struct HasBuckets<Container, std::void_t<decltype(std::declval<const Container&>().bucket_count())>> : std::true_type {};
+
+    // Bucket array length of hash containers, 0 for the others
+    template <typename Container>
+    std::size_t BucketCount(const Container& container)
+    {
+        if constexpr (HasBuckets<Container>::value)
+            return container.bucket_count();
+        else
+            return 0;
+    }
+}
@@ -0,0 +1,79 @@
+#include "order_entry.hpp"
+#include <algorithm>
+#include <cctype>
+
+OrderType ParseOrderType(const std::string& name)
+{
+    if (name == "GoodTillCancel") return OrderType::GoodTillCancel;
+    if (name == "FillAndKill") return OrderType::FillAndKill;
+    if (name == "FillOrKill") return OrderType::FillOrKill;
+    if (name == "GoodForDay") return OrderType::GoodForDay;
+    if (name == "Market") return OrderType::Market;
+    if (name == "Iceberg") return OrderType::Iceberg;
+    if (name == "Stop") return OrderType::Stop;
+    if (name == "StopLimit") return OrderType::StopLimit;
+    if (name == "PrimaryPeg") return OrderType::PrimaryPeg;
+    if (name == "MidpointPeg") return OrderType::MidpointPeg;
+    throw std::invalid_argument("Invalid order type");
+}
+
+Side ParseSide(const std::string& name)
+{
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (lower == "buy") return Side::Buy;
+    if (lower == "sell") return Side::Sell;
+    throw std::invalid_argument("Invalid side");
+}
+
+PostOnly ParsePostOnly(const std::string& name)
+{
+    if (name.empty()) return PostOnly::Off;
+    if (name == "Reject") return PostOnly::Reject;
+    if (name == "Slide") return PostOnly::Slide;
+    throw std::invalid_argument("Invalid post only mode");
+}
+
+SelfTradePrevention ParseSelfTradePrevention(const std::string& name)
+{
+    if (name.empty() || name == "CancelNewest") return SelfTradePrevention::CancelNewest;
+    if (name == "CancelOldest") return SelfTradePrevention::CancelOldest;
+    if (name == "CancelBoth") return SelfTradePrevention::CancelBoth;
+    if (name == "Decrement") return SelfTradePrevention::Decrement;
+    throw std::invalid_argument("Invalid self trade prevention mode");
+}
+
+void ValidateEntry(const OrderEntry& entry)
+{
+    if (entry.quantity_ == 0)
+        throw std::invalid_argument("Quantity must be positive");
+
+    switch (entry.type_) {
+        case OrderType::Market:
+        case OrderType::PrimaryPeg:
+        case OrderType::MidpointPeg:
+            break;
+        case OrderType::Stop:
+        case OrderType::StopLimit:
+            if (entry.stopPrice_ <= 0)
+                throw std::invalid_argument("Stop price must be positive");
+            if (entry.type_ == OrderType::StopLimit && entry.price_ <= 0)
+                throw std::invalid_argument("Price must be positive");
+            break;
+        case OrderType::Iceberg:
+            if (entry.displayQuantity_ == 0)
+                throw std::invalid_argument("Iceberg orders need a display quantity");
+            [[fallthrough]];
+        default:
+            if (entry.price_ <= 0)
+                throw std::invalid_argument("Price must be positive");
+    }
+}
+
+void ValidateModify(Price price, Quantity quantity)
+{
+    if (quantity == 0)
+        throw std::invalid_argument("Quantity must be positive");
+    if (price <= 0)
+        throw std::invalid_argument("Price must be positive");
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "types.hpp"
+#include <stdexcept>
+#include <string>
+
+/*
+ * Order entry shared by the gateways of the server. Each gateway decodes its wire format (protobuf
+ * strings, binary records) into an OrderEntry, and the checks and the Order built from it are the same
+ * whichever gateway the order came through. Violations throw std::invalid_argument with the message
+ * sent back to the client.
+ */
+
+// An order as a client sent it, prices in ticks
+struct OrderEntry {
+    OrderType type_ {OrderType::GoodTillCancel};
+    OrderId orderId_ {};
+    Side side_ {Side::Buy};
+    Price price_ {};            // Limit price, ignored by market and stop orders
+    Price stopPrice_ {};        // Stop and stop limit orders
+    Price pegOffset_ {};        // Pegged orders
+    Quantity quantity_ {};
+    Quantity displayQuantity_ {}; // Iceberg orders
+    PostOnly postOnly_ {PostOnly::Off};
+    OwnerId owner_ {};
+    SelfTradePrevention selfTradePrevention_ {SelfTradePrevention::CancelNewest};
+};
+
+// Protobuf spellings of the enums, as the gRPC requests carry them
+OrderType ParseOrderType(const std::string& name);
+// Case insensitive "buy" or "sell"
+Side ParseSide(const std::string& name);
+// Empty is Off
+PostOnly ParsePostOnly(const std::string& name);
+// Empty is CancelNewest
+SelfTradePrevention ParseSelfTradePrevention(const std::string& name);
+
+// Reject entries the book must never see: no quantity, missing prices
+void ValidateEntry(const OrderEntry& entry);
+// New price and quantity of a modify
+void ValidateModify(Price price, Quantity quantity);
+
+// Validate entry and make its order with Book::MakeOrder
+template <typename Book>
+typename Book::OrderPointer MakeEntryOrder(const OrderEntry& entry)
+{
+    ValidateEntry(entry);
+
+    typename Book::OrderPointer order;
+    if (entry.type_ == OrderType::Iceberg)
+        order = Book::MakeOrder(entry.orderId_, entry.side_, entry.price_, entry.quantity_, entry.displayQuantity_);
+    else if (entry.type_ == OrderType::Stop || entry.type_ == OrderType::StopLimit)
+        order = Book::MakeOrder(entry.type_, entry.orderId_, entry.side_, entry.price_, entry.stopPrice_, entry.quantity_);
+    else if (entry.type_ == OrderType::PrimaryPeg || entry.type_ == OrderType::MidpointPeg)
+        order = Book::MakeOrder(entry.type_, entry.orderId_, entry.side_, typename Book::PegOffset{entry.pegOffset_}, entry.quantity_);
+    else
+        order = Book::MakeOrder(entry.type_, entry.orderId_, entry.side_, entry.price_, entry.quantity_);
+
+    if (entry.postOnly_ != PostOnly::Off)
+        order->SetPostOnly(entry.postOnly_);
+    order->SetOwner(entry.owner_, entry.selfTradePrevention_);
+    return order;
+}
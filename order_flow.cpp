@@ -0,0 +1,68 @@
+#include "order_flow.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+OrderFlowWriter::OrderFlowWriter(const std::string& path, const std::string& symbol, std::uint32_t date)
+: path_{path}
+{
+    if (symbol.size() > sizeof(header_.symbol_))
+        throw std::invalid_argument("Symbol " + symbol + " is longer than 8 characters");
+
+    header_.magic_ = OrderFlowMagic;
+    header_.version_ = OrderFlowVersion;
+    header_.recordSize_ = sizeof(GatewayRequest);
+    std::memcpy(header_.symbol_, symbol.data(), symbol.size());
+    header_.date_ = date;
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_)
+        throw std::runtime_error("Cannot create " + path + ": " + std::strerror(errno));
+    // Rewritten with the count on Close
+    std::fwrite(&header_, sizeof(header_), 1, file_);
+}
+
+OrderFlowWriter::~OrderFlowWriter()
+{
+    if (file_)
+        std::fclose(file_);
+}
+
+void OrderFlowWriter::Append(const GatewayRequest& request)
+{
+    std::fwrite(&request, sizeof(request), 1, file_);
+    ++header_.count_;
+}
+
+void OrderFlowWriter::Close()
+{
+    const bool written = std::fseek(file_, 0, SEEK_SET) == 0
+        && std::fwrite(&header_, sizeof(header_), 1, file_) == 1
+        && !std::ferror(file_);
+    const bool closed = std::fclose(file_) == 0;
+    file_ = nullptr;
+    if (!written || !closed)
+        throw std::runtime_error("Cannot write " + path_);
+}
+
+OrderFlowFile::OrderFlowFile(const std::string& path)
+: file_{path}
+{
+    if (file_.Size() < sizeof(OrderFlowHeader))
+        throw std::runtime_error(path + " is too short for an order flow file");
+
+    const auto& header = Header();
+    if (header.magic_ != OrderFlowMagic)
+        throw std::runtime_error(path + " is not an order flow file");
+    if (header.version_ != OrderFlowVersion || header.recordSize_ != sizeof(GatewayRequest))
+        throw std::runtime_error(path + " has order flow version " + std::to_string(header.version_) + ", expected "
+            + std::to_string(OrderFlowVersion));
+    if ((file_.Size() - sizeof(OrderFlowHeader)) / sizeof(GatewayRequest) < header.count_)
+        throw std::runtime_error(path + " ends before its " + std::to_string(header.count_) + " records");
+}
+
+std::string OrderFlowFile::Symbol() const
+{
+    const auto& symbol = Header().symbol_;
+    return std::string(symbol, strnlen(symbol, sizeof(symbol)));
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "mapped_file.hpp"
+#include "shm_gateway.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+/*
+ * Recorded order flow, one file per symbol and day: an OrderFlowHeader, then the requests in the order the
+ * book received them. The records are GatewayRequests (shm_gateway.hpp), the fixed 64 byte add, cancel and
+ * modify records the gateways decode, so a file replays through the same ServeGatewayRequest as live flow.
+ * Integers are in the byte order of the machine that wrote the file. Files are read in place from a mapping.
+ */
+
+struct OrderFlowHeader {
+    std::uint64_t magic_;       // OrderFlowMagic
+    std::uint32_t version_;
+    std::uint32_t recordSize_;  // sizeof(GatewayRequest)
+    char symbol_[8];            // Padded with NULs
+    std::uint32_t date_;        // YYYYMMDD
+    std::uint32_t reserved0_;
+    std::uint64_t count_;       // Records that follow
+    std::uint8_t reserved_[24];
+};
+static_assert(sizeof(OrderFlowHeader) == 64, "OrderFlowHeader is part of the file format");
+
+constexpr std::uint64_t OrderFlowMagic = 0x31574f4c4642424fULL; // "OBBFLOW1" read as little-endian
+constexpr std::uint32_t OrderFlowVersion = 1;
+
+// Writes one file. The count in the header is filled in by Close
+class OrderFlowWriter
+{
+    public:
+        // std::invalid_argument if symbol is longer than 8 characters, std::runtime_error if path cannot be created
+        OrderFlowWriter(const std::string& path, const std::string& symbol, std::uint32_t date);
+        OrderFlowWriter(const OrderFlowWriter&) = delete;
+        OrderFlowWriter& operator=(const OrderFlowWriter&) = delete;
+        // Closes the file if Close was not called, without reporting errors
+        ~OrderFlowWriter();
+
+        void Append(const GatewayRequest& request);
+        // Complete the header and close. std::runtime_error if the file could not be written
+        void Close();
+        std::uint64_t Count() const { return header_.count_; }
+
+    private:
+        std::string path_;
+        std::FILE* file_;
+        OrderFlowHeader header_ {};
+};
+
+// A mapped file, checked against its header
+class OrderFlowFile
+{
+    public:
+        // std::runtime_error if path cannot be mapped, is not an order flow file or is cut short
+        explicit OrderFlowFile(const std::string& path);
+
+        const OrderFlowHeader& Header() const { return *reinterpret_cast<const OrderFlowHeader*>(file_.Data()); }
+        std::string Symbol() const;
+        const GatewayRequest* Records() const { return reinterpret_cast<const GatewayRequest*>(file_.Data() + sizeof(OrderFlowHeader)); }
+        std::size_t Count() const { return static_cast<std::size_t>(Header().count_); }
+
+    private:
+        MappedFile file_;
+};
@@ -9,10 +9,16 @@
  * Modify is simply cancel and replace. Cancel needs order id, replace needs price, quantity, and maybe side.
  * Being able to modify the side is sometimes looked down upon, but it is a feature that will be implemented.
  */
-class OrderModify
+template <typename PriceType, typename QuantityType>
+class BasicOrderModify
 {
     public:
-        OrderModify(OrderId orderId, Side side, Price price, Quantity quantity )
+        using Price = PriceType;
+        using Quantity = QuantityType;
+        using Order = BasicOrder<Price, Quantity>;
+        using OrderPointer = std::shared_ptr<Order>;
+
+        BasicOrderModify(OrderId orderId, Side side, Price price, Quantity quantity )
         : orderId_ {orderId}, price_ {price}, side_ {side}, quantity_ {quantity}
         {}
         OrderId GetOrderId() const { return orderId_; }
@@ -25,9 +31,23 @@ class OrderModify
             return std::make_shared<Order>(type, GetOrderId(), GetSide(), GetPrice(), GetQuantity());
         }
 
+        // Replacement for existing that keeps its type, owner and post only mode, and for icebergs its display quantity.
+        // Made with allocator, so a book keeps it in the memory its other orders are in (BasicOrderBook::MakeOrder)
+        template <typename Allocator>
+        OrderPointer ToOrderPointer(const Order& existing, const Allocator& allocator) const {
+            auto replacement = existing.GetOrderType() == OrderType::Iceberg
+                ? std::allocate_shared<Order>(allocator, GetOrderId(), GetSide(), GetPrice(), GetQuantity(), existing.GetDisplayQuantity())
+                : std::allocate_shared<Order>(allocator, existing.GetOrderType(), GetOrderId(), GetSide(), GetPrice(), GetQuantity());
+            replacement->SetOwner(existing.GetOwner(), existing.GetSelfTradePrevention());
+            replacement->SetPostOnly(existing.GetPostOnly());
+            return replacement;
+        }
+
     private:
         OrderId orderId_;    // ID of the order to modify
         Price price_;       // New price for the order
         Side side_;         // New side for the order
         Quantity quantity_; // New quantity for the order
-}; 
\ No newline at end of file
+};
+
+using OrderModify = BasicOrderModify<Price, Quantity>;
\ No newline at end of file
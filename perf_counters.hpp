@@ -0,0 +1,191 @@
+#pragma once
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Hardware performance counters around a benchmarked region, read through Linux perf_event_open.
+ * Counters that the kernel, the CPU or the container does not allow are reported as missing rather
+ * than failing the benchmark. On other platforms every counter is missing.
+ */
+
+enum class PerfCounter {
+    Cycles,
+    Instructions,
+    CacheMisses,
+    BranchMisses,
+};
+
+constexpr std::size_t PerfCounterCount = static_cast<std::size_t>(PerfCounter::BranchMisses) + 1;
+
+struct PerfCounterValues {
+    std::array<std::uint64_t, PerfCounterCount> values_ {};
+    std::array<bool, PerfCounterCount> valid_ {};
+
+    bool Has(PerfCounter counter) const { return valid_[static_cast<std::size_t>(counter)]; }
+    std::uint64_t Get(PerfCounter counter) const { return values_[static_cast<std::size_t>(counter)]; }
+
+    bool Any() const
+    {
+        for (bool valid : valid_)
+            if (valid)
+                return true;
+        return false;
+    }
+
+    // Instructions per cycle, 0 when either counter is missing
+    double Ipc() const
+    {
+        if (!Has(PerfCounter::Cycles) || !Has(PerfCounter::Instructions) || Get(PerfCounter::Cycles) == 0)
+            return 0.0;
+        return static_cast<double>(Get(PerfCounter::Instructions)) / static_cast<double>(Get(PerfCounter::Cycles));
+    }
+};
+
+class PerfCounters {
+    public:
+        // Counts the calling thread. With threads, also the threads it starts from now on, as they exit: a region
+        // that starts and joins worker threads counts all of them
+        explicit PerfCounters(bool threads = false)
+        : threads_{threads}
+        {
+            fds_.fill(-1);
+#ifdef __linux__
+            Open(PerfCounter::Cycles, PERF_COUNT_HW_CPU_CYCLES);
+            Open(PerfCounter::Instructions, PERF_COUNT_HW_INSTRUCTIONS);
+            Open(PerfCounter::CacheMisses, PERF_COUNT_HW_CACHE_MISSES);
+            Open(PerfCounter::BranchMisses, PERF_COUNT_HW_BRANCH_MISSES);
+#else
+            error_ = "perf_event_open is only available on Linux";
+#endif
+        }
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        ~PerfCounters()
+        {
+#ifdef __linux__
+            for (int fd : fds_)
+                if (fd >= 0)
+                    ::close(fd);
+#endif
+        }
+
+        // True if at least one counter could be opened
+        bool Available() const
+        {
+            for (int fd : fds_)
+                if (fd >= 0)
+                    return true;
+            return false;
+        }
+
+        // Why counters are missing, empty when all of them opened
+        const std::string& Error() const { return error_; }
+
+        void Start()
+        {
+#ifdef __linux__
+            for (int fd : fds_) {
+                if (fd < 0)
+                    continue;
+                ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        PerfCounterValues Stop()
+        {
+            PerfCounterValues result;
+#ifdef __linux__
+            for (int fd : fds_)
+                if (fd >= 0)
+                    ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+            for (std::size_t i = 0; i < fds_.size(); ++i) {
+                if (fds_[i] < 0)
+                    continue;
+
+                // value, time enabled, time running. Scale up when the kernel multiplexed the counter
+                std::uint64_t data[3] {};
+                if (::read(fds_[i], data, sizeof(data)) != sizeof(data) || data[2] == 0)
+                    continue;
+
+                result.values_[i] = data[2] < data[1]
+                    ? static_cast<std::uint64_t>(static_cast<double>(data[0]) * data[1] / data[2])
+                    : data[0];
+                result.valid_[i] = true;
+            }
+#endif
+            return result;
+        }
+
+    private:
+        std::array<int, PerfCounterCount> fds_ {};
+        std::string error_;
+        bool threads_;
+
+#ifdef __linux__
+        void Open(PerfCounter counter, std::uint64_t config)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.inherit = threads_ ? 1 : 0;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            const auto fd = ::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fd < 0) {
+                if (error_.empty())
+                    error_ = std::string("perf_event_open failed: ") + std::strerror(errno);
+                return;
+            }
+            fds_[static_cast<std::size_t>(counter)] = static_cast<int>(fd);
+        }
+#endif
+};
+
+// One line summary of a region, normalized per operation: "cycles/op=.. instr/op=.. IPC=.. cache-miss/op=.. branch-miss/op=.."
+inline std::string FormatPerfCounters(const PerfCounterValues& values, std::uint64_t operations)
+{
+    if (!values.Any())
+        return "perf counters unavailable";
+
+    const double perOp = operations ? 1.0 / static_cast<double>(operations) : 0.0;
+    std::string line;
+    char buffer[64];
+
+    auto append = [&](const char* label, PerfCounter counter) {
+        if (values.Has(counter))
+            std::snprintf(buffer, sizeof(buffer), "%s=%.2f ", label, static_cast<double>(values.Get(counter)) * perOp);
+        else
+            std::snprintf(buffer, sizeof(buffer), "%s=n/a ", label);
+        line += buffer;
+    };
+
+    append("cycles/op", PerfCounter::Cycles);
+    append("instr/op", PerfCounter::Instructions);
+    std::snprintf(buffer, sizeof(buffer), "IPC=%.2f ", values.Ipc());
+    line += buffer;
+    append("cache-miss/op", PerfCounter::CacheMisses);
+    append("branch-miss/op", PerfCounter::BranchMisses);
+    line.pop_back();
+    return line;
+}
@@ -2,61 +2,126 @@
 #include <memory>
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
 #include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/health_check_service_interface.h>
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
 
 #include "order_book.hpp"
+#include "itch_encoder.hpp"
+#include "trade_tape.hpp"
+#include "bar_aggregator.hpp"
+#include "matching_loop.hpp"
+#include "shm_gateway.hpp"
+#include "tcp_gateway.hpp"
+#include "trace.hpp"
 #include "orderbook.grpc.pb.h"
 
 using grpc::Server;
 using grpc::ServerBuilder;
 using grpc::ServerContext;
+using grpc::ServerWriter;
 using grpc::Status;
 using orderbook::OrderBookService;
 using orderbook::AddOrderRequest;
 using orderbook::CancelOrderRequest;
+using orderbook::ModifyOrderRequest;
 using orderbook::GetOrderBookRequest;
+using orderbook::GetOrderSnapshotRequest;
+using orderbook::GetStatsRequest;
+using orderbook::GetTradesRequest;
+using orderbook::GetTradesResponse;
+using orderbook::GetBarsRequest;
+using orderbook::GetBarsResponse;
+using orderbook::MassCancelRequest;
+using orderbook::BeginAuctionRequest;
+using orderbook::UncrossRequest;
+using orderbook::UncrossResponse;
+using orderbook::MassCancelResponse;
 using orderbook::OrderResponse;
 using orderbook::OrderBookResponse;
 using orderbook::PriceLevel;
+using orderbook::OrderSnapshotChunk;
+using orderbook::StatsResponse;
 
 class OrderBookServiceImpl final : public OrderBookService::Service {
 private:
-    static OrderBook& GetOrderBook() {
-        static OrderBook orderBook;
+    // Containers and orders live in HugePageArena::Default(), mapped by --huge-page-arena
+    static HugePageOrderBook& GetOrderBook() {
+        static HugePageOrderBook orderBook;
         return orderBook;
     }
 
+    // Every call into the order book runs on this loop's thread, the gRPC threads only parse and reply
+    MatchingLoop& matchingLoop_;
+    // Written by the book on the matching thread, read by GetTrades without going through the loop
+    const TradeTape& tradeTape_;
+    // Updated by the book on the matching thread, and only read there
+    BarAggregator& bars_;
+
 public:
+    OrderBookServiceImpl(MatchingLoop& matchingLoop, const TradeTape& tradeTape, BarAggregator& bars)
+    : matchingLoop_{matchingLoop}
+    , tradeTape_{tradeTape}
+    , bars_{bars}
+    {}
+
+    // Protection band of market orders, in cents
+    static void SetMarketProtection(Price ticks) {
+        GetOrderBook().SetMarketProtection(ticks);
+    }
+
+    // Called on the matching thread like every other book call
+    static void SetMarketDataEncoder(ItchEncoder* encoder) {
+        GetOrderBook().SetMarketDataEncoder(encoder);
+    }
+
+    static void SetTradeTape(TradeTape* tape) {
+        GetOrderBook().SetTradeTape(tape);
+    }
+
+    static void SetBarAggregator(BarAggregator* bars) {
+        GetOrderBook().SetBarAggregator(bars);
+    }
+
+    static std::size_t PruneGoodForDay() {
+        return GetOrderBook().PruneGoodForDay();
+    }
+
+    // Handler of the shared memory gateway. It runs on the matching thread, which polls the gateway
+    static void ServeGatewayRequest(const GatewayRequest& request, GatewayResponse& response) {
+        ::ServeGatewayRequest(GetOrderBook(), request, response);
+    }
+
     Status AddOrder(ServerContext* context, const AddOrderRequest* request, OrderResponse* response) override {
         try {
-            OrderType orderType;
-            if (request->order_type() == "GoodTillCancel") orderType = OrderType::GoodTillCancel;
-            else if (request->order_type() == "FillAndKill") orderType = OrderType::FillAndKill;
-            else if (request->order_type() == "FillOrKill") orderType = OrderType::FillOrKill;
-            else if (request->order_type() == "GoodForDay") orderType = OrderType::GoodForDay;
-            else if (request->order_type() == "Market") orderType = OrderType::Market;
-            else throw std::invalid_argument("Invalid order type");
-
-            Side side;
-            std::string sideStr = request->side();
-            std::transform(sideStr.begin(), sideStr.end(), sideStr.begin(), ::tolower);
-            if (sideStr == "buy") side = Side::Buy;
-            else if (sideStr == "sell") side = Side::Sell;
-            else throw std::invalid_argument("Invalid side");
-
-            auto order = std::make_shared<Order>(
-                orderType,
-                request->order_id(),
-                side,
-                static_cast<Price>(request->price() * 100), // Convert to integer cents
-                request->quantity()
-            );
-            
-            Trades trades = GetOrderBook().AddOrder(order);
+            // Same checks as the shared memory gateway, see order_entry.hpp
+            OrderEntry entry;
+            entry.type_ = ParseOrderType(request->order_type());
+            entry.orderId_ = request->order_id();
+            entry.side_ = ParseSide(request->side());
+            entry.price_ = static_cast<Price>(request->price() * 100); // Convert to integer cents
+            entry.stopPrice_ = static_cast<Price>(request->stop_price() * 100);
+            entry.pegOffset_ = static_cast<Price>(request->peg_offset() * 100);
+            entry.quantity_ = request->quantity();
+            entry.displayQuantity_ = request->display_quantity();
+            entry.postOnly_ = ParsePostOnly(request->post_only());
+            entry.owner_ = request->owner_id();
+            entry.selfTradePrevention_ = ParseSelfTradePrevention(request->self_trade_prevention());
+            const auto order = MakeEntryOrder<HugePageOrderBook>(entry);
+
+            Trades trades = matchingLoop_.Run([&] { return GetOrderBook().AddOrder(order); });
             
             if (!trades.empty()) {
                 response->set_success(true);
@@ -76,7 +141,7 @@ public:
 
     Status CancelOrder(ServerContext* context, const CancelOrderRequest* request, OrderResponse* response) override {
         try {
-            GetOrderBook().CancelOrder(request->order_id());
+            matchingLoop_.Run([&] { GetOrderBook().CancelOrder(request->order_id()); });
             response->set_success(true);
             response->set_message("Order cancelled successfully");
             return Status::OK;
@@ -87,9 +152,81 @@ public:
         }
     }
 
+    Status ModifyOrder(ServerContext* context, const ModifyOrderRequest* request, OrderResponse* response) override {
+        try {
+            const auto side = ParseSide(request->side());
+            const auto price = static_cast<Price>(request->price() * 100); // Convert to integer cents
+            ValidateModify(price, static_cast<Quantity>(request->quantity()));
+            Trades trades = matchingLoop_.Run([&] {
+                return GetOrderBook().Match(OrderModify{static_cast<OrderId>(request->order_id()), side, price,
+                    static_cast<Quantity>(request->quantity())});
+            });
+
+            response->set_success(true);
+            response->set_message(trades.empty() ? "Order modified" : "Order modified and executed");
+            return Status::OK;
+        } catch (const std::exception& e) {
+            response->set_success(false);
+            response->set_message(std::string("Error modifying order: ") + e.what());
+            return Status::OK;
+        }
+    }
+
+    Status MassCancel(ServerContext* context, const MassCancelRequest* request, MassCancelResponse* response) override {
+        MassCancelFilter filter;
+        if (request->owner_id() != Constants::NoOwner)
+            filter.owner_ = request->owner_id();
+
+        std::string sideStr = request->side();
+        std::transform(sideStr.begin(), sideStr.end(), sideStr.begin(), ::tolower);
+        if (sideStr == "buy") filter.side_ = Side::Buy;
+        else if (sideStr == "sell") filter.side_ = Side::Sell;
+        else if (!sideStr.empty()) return Status(grpc::StatusCode::INVALID_ARGUMENT, "Invalid side");
+
+        if (request->has_min_price())
+            filter.minPrice_ = static_cast<Price>(request->min_price() * 100);
+        if (request->has_max_price())
+            filter.maxPrice_ = static_cast<Price>(request->max_price() * 100);
+
+        const auto result = matchingLoop_.Run([&] { return GetOrderBook().MassCancel(filter); });
+        response->set_cancelled(static_cast<std::int32_t>(result.cancelled_));
+        for (const auto& [price, quantity] : result.bids_) {
+            auto* priceLevel = response->add_bids();
+            priceLevel->set_price(price);
+            priceLevel->set_quantity(quantity);
+        }
+        for (const auto& [price, quantity] : result.asks_) {
+            auto* priceLevel = response->add_asks();
+            priceLevel->set_price(price);
+            priceLevel->set_quantity(quantity);
+        }
+        return Status::OK;
+    }
+
+    Status BeginAuction(ServerContext* context, const BeginAuctionRequest* request, OrderResponse* response) override {
+        matchingLoop_.Run([] { GetOrderBook().BeginAuction(); });
+        response->set_success(true);
+        response->set_message("Auction started");
+        return Status::OK;
+    }
+
+    Status Uncross(ServerContext* context, const UncrossRequest* request, UncrossResponse* response) override {
+        const auto [equilibrium, trades] = matchingLoop_.Run([] {
+            const auto equilibrium = GetOrderBook().GetAuctionEquilibrium();
+            return std::make_pair(equilibrium, GetOrderBook().Uncross());
+        });
+        response->set_executed(equilibrium.has_value());
+        if (equilibrium) {
+            response->set_price(equilibrium->price_);
+            response->set_volume(static_cast<std::int64_t>(equilibrium->volume_));
+        }
+        response->set_trades(static_cast<std::int32_t>(trades.size()));
+        return Status::OK;
+    }
+
     Status GetOrderBook(ServerContext* context, const GetOrderBookRequest* request, OrderBookResponse* response) override {
         try {
-            auto levelInfos = GetOrderBook().GetOrderInfos();
+            auto levelInfos = matchingLoop_.Run([] { return GetOrderBook().GetOrderInfos(); });
             auto bids = levelInfos.GetBids();
             auto asks = levelInfos.GetAsks();
 
@@ -110,11 +247,206 @@ public:
             return Status(grpc::StatusCode::INTERNAL, e.what());
         }
     }
+
+    // Streams every resting order. The matching thread only copies them into a flat buffer, the messages are
+    // built and sent from this thread
+    Status GetOrderSnapshot(ServerContext* context, const GetOrderSnapshotRequest* request, ServerWriter<OrderSnapshotChunk>* writer) override {
+        try {
+            // Filled by the matching thread and grown here, so it is captured by reference and never thread local
+            std::vector<HugePageOrderBook::OrderSnapshot> orders;
+            std::size_t count = 0;
+            while ((count = matchingLoop_.Run([&orders] { return GetOrderBook().GetOrderSnapshot(orders.data(), orders.size()); })) > orders.size())
+                orders.resize(count + count / 4); // Headroom for orders added before the next try
+
+            const std::size_t chunkSize = request->max_orders() > 0 ? request->max_orders() : 4096;
+            OrderSnapshotChunk chunk;
+            for (std::size_t first = 0; first < count; first += chunkSize) {
+                chunk.clear_orders();
+                for (std::size_t i = first; i < std::min(count, first + chunkSize); ++i) {
+                    auto* order = chunk.add_orders();
+                    order->set_order_id(orders[i].orderId_);
+                    order->set_side(orders[i].side_ == Side::Buy ? "Buy" : "Sell");
+                    order->set_price(orders[i].price_);
+                    order->set_quantity(orders[i].quantity_);
+                    order->set_position(orders[i].position_);
+                }
+                if (!writer->Write(chunk))
+                    return Status(grpc::StatusCode::CANCELLED, "Client stopped reading the snapshot");
+            }
+            return Status::OK;
+        } catch (const std::exception& e) {
+            return Status(grpc::StatusCode::INTERNAL, e.what());
+        }
+    }
+
+    // Time and sales after since_sequence, read from the tape while the matching thread keeps trading
+    Status GetTrades(ServerContext* context, const GetTradesRequest* request, GetTradesResponse* response) override {
+        constexpr std::size_t MaxTrades = 1000;
+        std::size_t limit = request->limit() > 0 ? request->limit() : MaxTrades;
+        limit = std::min(limit, MaxTrades);
+
+        TradeRecord trades[MaxTrades];
+        const auto count = tradeTape_.Read(request->since_sequence(), limit, trades);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto* trade = response->add_trades();
+            trade->set_sequence(trades[i].sequence_);
+            trade->set_timestamp(trades[i].timestamp_);
+            trade->set_aggressor_side(trades[i].aggressor_ == Side::Buy ? "Buy" : "Sell");
+            trade->set_price(trades[i].price_);
+            trade->set_quantity(trades[i].quantity_);
+        }
+        response->set_last_sequence(tradeTape_.LastSequence());
+        return Status::OK;
+    }
+
+    // Bars of one interval. Those whose interval is over are finalized first, even if no trade came after them
+    Status GetBars(ServerContext* context, const GetBarsRequest* request, GetBarsResponse* response) override {
+        try {
+            const std::chrono::seconds interval{request->interval_seconds()};
+            const std::size_t count = request->count() > 0 ? request->count() : BarAggregator::DefaultHistory;
+            const auto [bars, openBar] = matchingLoop_.Run([&] {
+                bars_.Advance(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count()));
+                return std::make_pair(bars_.GetBars(interval, count), bars_.GetOpenBar(interval));
+            });
+
+            auto Fill = [](const BarAggregator::Bar& bar, orderbook::Bar* out) {
+                out->set_start(bar.start_);
+                out->set_open(bar.open_);
+                out->set_high(bar.high_);
+                out->set_low(bar.low_);
+                out->set_close(bar.close_);
+                out->set_volume(bar.volume_);
+                out->set_vwap(bar.Vwap());
+                out->set_trades(bar.trades_);
+            };
+            for (const auto& bar : bars)
+                Fill(bar, response->add_bars());
+            if (openBar)
+                Fill(*openBar, response->mutable_open_bar());
+            return Status::OK;
+        } catch (const std::invalid_argument& e) {
+            return Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+        } catch (const std::exception& e) {
+            return Status(grpc::StatusCode::INTERNAL, e.what());
+        }
+    }
+
+    // Reads the engine metrics without taking the order book lock or going through the matching loop
+    Status GetStats(ServerContext* context, const GetStatsRequest* request, StatsResponse* response) override {
+        response->set_text(RenderMetrics(GetOrderBook().GetMetrics())
+            + RenderHistogram("orderbook_matching_wakeup_seconds",
+                "Time from a request being handed to the matching thread to the thread picking it up.",
+                matchingLoop_.WakeupLatency()));
+        return Status::OK;
+    }
 };
 
-void RunServer() {
+// Order entry endpoints besides gRPC, off unless asked for
+// Cancels the GoodForDay orders at every close. Its thread only waits for the close, the prune is handed to the
+// matching thread like every other call into the book
+class GoodForDayPruner {
+public:
+    explicit GoodForDayPruner(MatchingLoop& matchingLoop)
+    : matchingLoop_{matchingLoop}
+    , thread_{[this] { Run(); }}
+    {}
+
+    GoodForDayPruner(const GoodForDayPruner&) = delete;
+    GoodForDayPruner& operator=(const GoodForDayPruner&) = delete;
+
+    ~GoodForDayPruner() {
+        {
+            std::scoped_lock lock{mutex_};
+            stop_ = true;
+        }
+        condition_.notify_one();
+        thread_.join();
+    }
+
+private:
+    MatchingLoop& matchingLoop_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ {false};
+    std::thread thread_;
+
+    void Run() {
+        std::unique_lock lock{mutex_};
+        while (!condition_.wait_until(lock, HugePageOrderBook::NextGoodForDayClose(std::chrono::system_clock::now()), [this] { return stop_; })) {
+            lock.unlock();
+            const auto pruned = matchingLoop_.Run([] { return OrderBookServiceImpl::PruneGoodForDay(); });
+            std::cout << "Cancelled " << pruned << " GoodForDay orders at the close" << std::endl;
+            lock.lock();
+        }
+    }
+};
+
+struct GatewayOptions {
+    std::size_t shmClients_ {};
+    std::optional<std::uint16_t> tcpPort_;
+};
+
+// Market data of the book as ITCH, appended to marketDataPath unless it is empty, and bars at barIntervals
+void RunServer(const MatchingLoopOptions& options, const GatewayOptions& gateways, const std::string& marketDataPath,
+    const std::vector<std::chrono::nanoseconds>& barIntervals) {
     std::string server_address("0.0.0.0:50051");
-    OrderBookServiceImpl service;
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> marketDataFile{nullptr, &std::fclose};
+    std::optional<ItchEncoder> marketData;
+    if (!marketDataPath.empty()) {
+        marketDataFile.reset(std::fopen(marketDataPath.c_str(), "ab"));
+        if (!marketDataFile)
+            throw std::runtime_error("Cannot open market data file " + marketDataPath);
+        marketData.emplace(1, "BOOK", 1 << 16, [file = marketDataFile.get()](std::uint64_t, std::size_t, const std::uint8_t* data, std::size_t size) {
+            std::fwrite(data, 1, size, file);
+            std::fflush(file);
+        });
+        std::cout << "Market data to " << marketDataPath << std::endl;
+    }
+
+    // Declared before the loop, so the loop thread has stopped polling it when it goes away
+    std::optional<ShmGateway> gateway;
+    if (gateways.shmClients_ > 0) {
+        gateway.emplace("orderbook-gateway", gateways.shmClients_, &OrderBookServiceImpl::ServeGatewayRequest);
+        std::cout << "Shared memory gateway: /dev/shm/" << ShmGateway::SegmentName("orderbook-gateway", 0)
+                  << " to " << ShmGateway::SegmentName("orderbook-gateway", gateways.shmClients_ - 1) << std::endl;
+    }
+
+    MatchingLoop matchingLoop{options};
+    if (options.cpu_ && !matchingLoop.IsPinned())
+        std::cerr << "Could not pin the matching thread to CPU " << *options.cpu_ << std::endl;
+    // Market data goes out whenever the matching thread runs out of work, so a burst is written at once
+    if (gateway || marketData) {
+        matchingLoop.SetPoller([&gateway, &marketData] {
+            const bool served = gateway && gateway->Poll();
+            if (!served && marketData)
+                marketData->Flush();
+            return served;
+        });
+    }
+    if (marketData)
+        matchingLoop.Run([&marketData] { OrderBookServiceImpl::SetMarketDataEncoder(&*marketData); });
+    TradeTape tradeTape;
+    BarAggregator bars{barIntervals};
+    matchingLoop.Run([&tradeTape, &bars] {
+        OrderBookServiceImpl::SetTradeTape(&tradeTape);
+        OrderBookServiceImpl::SetBarAggregator(&bars);
+    });
+
+    // Each batch of TCP requests is one hand over to the matching thread
+    std::optional<TcpGateway> tcpGateway;
+    if (gateways.tcpPort_) {
+        tcpGateway.emplace(*gateways.tcpPort_, [&matchingLoop](const GatewayRequest* requests, GatewayResponse* responses, std::size_t count) {
+            matchingLoop.Run([&] {
+                for (std::size_t i = 0; i < count; ++i)
+                    OrderBookServiceImpl::ServeGatewayRequest(requests[i], responses[i]);
+            });
+        });
+        std::cout << "TCP order entry listening on port " << tcpGateway->Port() << std::endl;
+    }
+    OrderBookServiceImpl service{matchingLoop, tradeTape, bars};
+    // Declared after the loop, so it stops submitting before the loop goes away
+    GoodForDayPruner pruner{matchingLoop};
 
     grpc::EnableDefaultHealthCheckService(true);
     grpc::reflection::InitProtoReflectionServerBuilderPlugin();
@@ -126,9 +458,68 @@ void RunServer() {
     std::unique_ptr<Server> server(builder.BuildAndStart());
     std::cout << "Server listening on " << server_address << std::endl;
     server->Wait();
+    matchingLoop.Run([] {
+        OrderBookServiceImpl::SetMarketDataEncoder(nullptr);
+        OrderBookServiceImpl::SetTradeTape(nullptr);
+        OrderBookServiceImpl::SetBarAggregator(nullptr);
+    });
 }
 
 int main(int argc, char** argv) {
-    RunServer();
+    MatchingLoopOptions options;
+    GatewayOptions gateways;
+    std::string marketDataPath;
+    std::vector<std::chrono::nanoseconds> barIntervals{std::chrono::seconds{1}, std::chrono::minutes{1}, std::chrono::minutes{5}};
+    for (int i = 1; i < argc; ++i) {
+        // --huge-page-arena <MB>: map and prefault the book memory up front
+        if (std::strcmp(argv[i], "--huge-page-arena") == 0 && i + 1 < argc) {
+            const auto& arena = HugePageArena::ConfigureDefault(std::stoull(argv[++i]) << 20);
+            std::cout << "Order book arena: " << (arena.Capacity() >> 20) << "MB on " << ToString(arena.GetBacking()) << std::endl;
+        }
+        // --trace-dump <path>: write the engine trace rings to path on SIGUSR1
+        else if (std::strcmp(argv[i], "--trace-dump") == 0 && i + 1 < argc) {
+            const char* path = argv[++i];
+            if (Tracer::InstallDumpOnSignal(SIGUSR1, path))
+                std::cout << "Trace dump on SIGUSR1 to " << path << std::endl;
+            else
+                std::cerr << "Could not install trace dump handler for " << path << std::endl;
+        }
+        // --market-protection <cents>: market orders trade at most this far past the best opposite price
+        else if (std::strcmp(argv[i], "--market-protection") == 0 && i + 1 < argc) {
+            OrderBookServiceImpl::SetMarketProtection(static_cast<Price>(std::stol(argv[++i])));
+        }
+        // --matching-cpu <cpu>: pin the thread that runs every order book call
+        else if (std::strcmp(argv[i], "--matching-cpu") == 0 && i + 1 < argc) {
+            options.cpu_ = std::stoi(argv[++i]);
+        }
+        // --spin <n> / --yield <n>: polls before the matching thread yields, and before it parks
+        else if (std::strcmp(argv[i], "--spin") == 0 && i + 1 < argc) {
+            options.spinIterations_ = static_cast<std::uint32_t>(std::stoul(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--yield") == 0 && i + 1 < argc) {
+            options.yieldIterations_ = static_cast<std::uint32_t>(std::stoul(argv[++i]));
+        }
+        // --shm-gateway <clients>: serve that many co-located clients over shared memory rings
+        else if (std::strcmp(argv[i], "--shm-gateway") == 0 && i + 1 < argc) {
+            gateways.shmClients_ = std::stoul(argv[++i]);
+        }
+        // --tcp-gateway <port>: binary order entry over TCP, see tcp_gateway.hpp
+        else if (std::strcmp(argv[i], "--tcp-gateway") == 0 && i + 1 < argc) {
+            gateways.tcpPort_ = static_cast<std::uint16_t>(std::stoul(argv[++i]));
+        }
+        // --market-data <path>: append the book's events to path as ITCH messages, see itch_encoder.hpp
+        else if (std::strcmp(argv[i], "--market-data") == 0 && i + 1 < argc) {
+            marketDataPath = argv[++i];
+        }
+        // --bars <seconds,...>: intervals of the OHLCV bars GetBars serves, 1,60,300 by default
+        else if (std::strcmp(argv[i], "--bars") == 0 && i + 1 < argc) {
+            barIntervals.clear();
+            std::istringstream intervals{argv[++i]};
+            for (std::string interval; std::getline(intervals, interval, ',');)
+                barIntervals.push_back(std::chrono::seconds{std::stoul(interval)});
+        }
+    }
+
+    RunServer(options, gateways, marketDataPath, barIntervals);
     return 0;
 } 
\ No newline at end of file
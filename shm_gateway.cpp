@@ -0,0 +1,197 @@
+#include "shm_gateway.hpp"
+#include <cerrno>
+#include <new>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    std::runtime_error SystemError(const std::string& what, const std::string& name)
+    {
+        return std::runtime_error(what + " " + name + ": " + std::strerror(errno));
+    }
+
+    // Map the segment called name, creating it when create is set
+    GatewaySegment* MapSegment(const std::string& name, bool create)
+    {
+#if defined(__linux__)
+        const auto path = "/" + name;
+        if (create)
+            shm_unlink(path.c_str()); // A segment left over by a server that died, its clients are gone too
+
+        const int fd = shm_open(path.c_str(), create ? O_RDWR | O_CREAT | O_EXCL : O_RDWR, 0600);
+        if (fd < 0)
+            throw SystemError("Cannot open gateway segment", name);
+        if (create && ftruncate(fd, sizeof(GatewaySegment)) != 0) {
+            close(fd);
+            throw SystemError("Cannot size gateway segment", name);
+        }
+
+        void* memory = mmap(nullptr, sizeof(GatewaySegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (memory == MAP_FAILED)
+            throw SystemError("Cannot map gateway segment", name);
+        return static_cast<GatewaySegment*>(memory);
+#else
+        (void)create;
+        throw std::runtime_error("Shared memory gateway is only supported on Linux, cannot open " + name);
+#endif
+    }
+
+    void UnmapSegment(GatewaySegment* segment)
+    {
+#if defined(__linux__)
+        munmap(segment, sizeof(GatewaySegment));
+#else
+        (void)segment;
+#endif
+    }
+
+    template <typename Enum>
+    Enum DecodeEnum(std::uint8_t value, Enum last, const char* what)
+    {
+        if (value > static_cast<std::uint8_t>(last))
+            throw std::invalid_argument(what);
+        return static_cast<Enum>(value);
+    }
+}
+
+GatewayRequest MakeAddRequest(std::uint64_t sequence, const OrderEntry& entry)
+{
+    GatewayRequest request{};
+    request.sequence_ = sequence;
+    request.message_ = static_cast<std::uint8_t>(GatewayMessage::Add);
+    request.orderId_ = entry.orderId_;
+    request.orderType_ = static_cast<std::uint8_t>(entry.type_);
+    request.side_ = static_cast<std::uint8_t>(entry.side_);
+    request.price_ = entry.price_;
+    request.stopPrice_ = entry.stopPrice_;
+    request.pegOffset_ = entry.pegOffset_;
+    request.quantity_ = entry.quantity_;
+    request.displayQuantity_ = entry.displayQuantity_;
+    request.postOnly_ = static_cast<std::uint8_t>(entry.postOnly_);
+    request.owner_ = entry.owner_;
+    request.selfTradePrevention_ = static_cast<std::uint8_t>(entry.selfTradePrevention_);
+    return request;
+}
+
+GatewayRequest MakeCancelRequest(std::uint64_t sequence, OrderId orderId)
+{
+    GatewayRequest request{};
+    request.sequence_ = sequence;
+    request.message_ = static_cast<std::uint8_t>(GatewayMessage::Cancel);
+    request.orderId_ = orderId;
+    return request;
+}
+
+GatewayRequest MakeModifyRequest(std::uint64_t sequence, OrderId orderId, Side side, Price price, Quantity quantity)
+{
+    GatewayRequest request{};
+    request.sequence_ = sequence;
+    request.message_ = static_cast<std::uint8_t>(GatewayMessage::Modify);
+    request.orderId_ = orderId;
+    request.side_ = static_cast<std::uint8_t>(side);
+    request.price_ = price;
+    request.quantity_ = quantity;
+    return request;
+}
+
+OrderEntry DecodeEntry(const GatewayRequest& request)
+{
+    OrderEntry entry;
+    entry.type_ = DecodeEnum(request.orderType_, OrderType::MidpointPeg, "Invalid order type");
+    entry.orderId_ = request.orderId_;
+    entry.side_ = DecodeEnum(request.side_, Side::Sell, "Invalid side");
+    entry.price_ = request.price_;
+    entry.stopPrice_ = request.stopPrice_;
+    entry.pegOffset_ = request.pegOffset_;
+    entry.quantity_ = request.quantity_;
+    entry.displayQuantity_ = request.displayQuantity_;
+    entry.postOnly_ = DecodeEnum(request.postOnly_, PostOnly::Slide, "Invalid post only mode");
+    entry.owner_ = request.owner_;
+    entry.selfTradePrevention_ = DecodeEnum(request.selfTradePrevention_, SelfTradePrevention::Decrement,
+        "Invalid self trade prevention mode");
+    return entry;
+}
+
+ShmGateway::ShmGateway(const std::string& name, std::size_t clients, Handler handler)
+: handler_{std::move(handler)}
+{
+    try {
+        for (std::size_t client = 0; client < clients; ++client) {
+            auto segmentName = SegmentName(name, client);
+            auto* segment = new (MapSegment(segmentName, true)) GatewaySegment{};
+            segment->version_ = GatewaySegment::Version;
+            // Clients check the magic, so it goes in last
+            segment->magic_.store(GatewaySegment::Magic, std::memory_order_release);
+            clients_.push_back(Client{std::move(segmentName), segment});
+        }
+    }
+    catch (...) {
+        Close();
+        throw;
+    }
+}
+
+ShmGateway::~ShmGateway()
+{
+    Close();
+}
+
+void ShmGateway::Close()
+{
+    for (auto& client : clients_) {
+        UnmapSegment(client.segment_);
+#if defined(__linux__)
+        shm_unlink(("/" + client.name_).c_str());
+#endif
+    }
+    clients_.clear();
+}
+
+std::string ShmGateway::SegmentName(const std::string& name, std::size_t client)
+{
+    return name + "-" + std::to_string(client);
+}
+
+bool ShmGateway::Poll()
+{
+    bool served = false;
+    GatewayRequest request;
+    GatewayResponse response;
+    for (auto& client : clients_) {
+        auto& segment = *client.segment_;
+        // A request is only taken once its response has room, a client that stops reading stalls itself only
+        for (std::size_t i = 0; i < Batch && !segment.responses_.Full() && segment.requests_.TryPop(request); ++i) {
+            handler_(request, response);
+            segment.responses_.TryPush(response);
+            served = true;
+        }
+    }
+    return served;
+}
+
+ShmGatewayClient::ShmGatewayClient(const std::string& segmentName)
+: segment_{MapSegment(segmentName, false)}
+{
+    if (segment_->magic_.load(std::memory_order_acquire) != GatewaySegment::Magic || segment_->version_ != GatewaySegment::Version) {
+        UnmapSegment(segment_);
+        throw std::runtime_error("Gateway segment " + segmentName + " is not ready or from another version");
+    }
+
+    std::uint32_t free = 0;
+    if (!segment_->attached_.compare_exchange_strong(free, 1, std::memory_order_acq_rel)) {
+        UnmapSegment(segment_);
+        throw std::runtime_error("Gateway segment " + segmentName + " already has a client");
+    }
+}
+
+ShmGatewayClient::~ShmGatewayClient()
+{
+    segment_->attached_.store(0, std::memory_order_release);
+    UnmapSegment(segment_);
+}
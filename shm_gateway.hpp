@@ -0,0 +1,177 @@
+#pragma once
+#include "order_entry.hpp"
+#include "order_modify.hpp"
+#include "spsc_ring.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * Order entry for clients on the same machine, without protobuf, HTTP/2 or a socket in between.
+ * The server maps one segment per client slot in /dev/shm. A segment holds a ring of fixed size
+ * binary requests (add, cancel, modify) from the client and a ring of responses back, so each ring has
+ * exactly one producer and one consumer. The matching thread polls the request rings directly (see
+ * MatchingLoop::SetPoller) and answers every request with one response, in order.
+ * Requests go through the same validation as the gRPC ones (order_entry.hpp).
+ */
+
+enum class GatewayMessage : std::uint8_t {
+    Add = 1,
+    Cancel,
+    Modify,
+};
+
+enum class GatewayStatus : std::uint8_t {
+    Accepted = 1,
+    Rejected,
+};
+
+// One request, a cache line. Enum fields carry the values of the engine enums in types.hpp, prices are in ticks
+struct GatewayRequest {
+    std::uint64_t sequence_;    // Chosen by the client and echoed in the response
+    OrderId orderId_;
+    Price price_;               // Add and modify
+    Price stopPrice_;           // Stop orders
+    Price pegOffset_;           // Pegged orders
+    Quantity quantity_;         // Add and modify
+    Quantity displayQuantity_;  // Iceberg orders
+    OwnerId owner_;
+    std::uint8_t message_;      // GatewayMessage
+    std::uint8_t orderType_;
+    std::uint8_t side_;
+    std::uint8_t postOnly_;
+    std::uint8_t selfTradePrevention_;
+    std::uint8_t reserved_[19];
+};
+static_assert(sizeof(GatewayRequest) == 64, "Gateway requests are one cache line");
+
+// The answer to one request, a cache line
+struct GatewayResponse {
+    std::uint64_t sequence_;
+    OrderId orderId_;
+    Quantity filledQuantity_;   // Traded by the order of the request
+    std::uint32_t trades_;      // Trades the request caused, including those of other orders it released
+    std::uint8_t status_;       // GatewayStatus
+    char text_[39];             // Why it was rejected, NUL terminated
+};
+static_assert(sizeof(GatewayResponse) == 64, "Gateway responses are one cache line");
+
+// What one client slot in /dev/shm holds
+struct GatewaySegment {
+    static constexpr std::uint32_t Magic = 0x4f424757;
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::size_t RingCapacity = 4096;
+
+    std::atomic<std::uint32_t> magic_;
+    std::uint32_t version_;
+    std::atomic<std::uint32_t> attached_; // A client holds the slot, a second one would break single producer
+    SpscRing<GatewayRequest, RingCapacity> requests_;
+    SpscRing<GatewayResponse, RingCapacity> responses_;
+};
+
+GatewayRequest MakeAddRequest(std::uint64_t sequence, const OrderEntry& entry);
+GatewayRequest MakeCancelRequest(std::uint64_t sequence, OrderId orderId);
+GatewayRequest MakeModifyRequest(std::uint64_t sequence, OrderId orderId, Side side, Price price, Quantity quantity);
+// The entry of an add request. std::invalid_argument on enum values the engine does not have
+OrderEntry DecodeEntry(const GatewayRequest& request);
+// Decode, validate and apply request to book, and fill in response. Run it on the thread that owns book
+template <typename Book>
+void ServeGatewayRequest(Book& book, const GatewayRequest& request, GatewayResponse& response);
+
+// Server side: creates the client segments and serves their requests
+class ShmGateway
+{
+    public:
+        using Handler = std::function<void(const GatewayRequest&, GatewayResponse&)>;
+
+        // Requests served from one client per Poll, so a busy client cannot starve the others
+        static constexpr std::size_t Batch = 64;
+
+        // Create (or recreate) the segments /dev/shm/<name>-0 to <name>-<clients - 1>, std::runtime_error on failure
+        ShmGateway(const std::string& name, std::size_t clients, Handler handler);
+        ShmGateway(const ShmGateway&) = delete;
+        ShmGateway& operator=(const ShmGateway&) = delete;
+        // Unmaps and removes the segments
+        ~ShmGateway();
+
+        // Serve what the clients sent. True if there was anything. Only ever call it from one thread
+        bool Poll();
+
+        std::size_t Clients() const { return clients_.size(); }
+        // Shared memory name of a client slot, what ShmGatewayClient takes
+        static std::string SegmentName(const std::string& name, std::size_t client);
+
+    private:
+        struct Client {
+            std::string name_;
+            GatewaySegment* segment_;
+        };
+
+        std::vector<Client> clients_;
+        Handler handler_;
+
+        void Close();
+};
+
+// Client side of one slot
+class ShmGatewayClient
+{
+    public:
+        // Attach to a slot the server created. std::runtime_error if it does not exist or another client holds it
+        explicit ShmGatewayClient(const std::string& segmentName);
+        ShmGatewayClient(const ShmGatewayClient&) = delete;
+        ShmGatewayClient& operator=(const ShmGatewayClient&) = delete;
+        // Releases the slot
+        ~ShmGatewayClient();
+
+        // False when the request ring is full: the server is behind, retry later
+        bool TrySend(const GatewayRequest& request) { return segment_->requests_.TryPush(request); }
+        bool TryReceive(GatewayResponse& response) { return segment_->responses_.TryPop(response); }
+
+    private:
+        GatewaySegment* segment_;
+};
+
+template <typename Book>
+void ServeGatewayRequest(Book& book, const GatewayRequest& request, GatewayResponse& response)
+{
+    response = GatewayResponse{};
+    response.sequence_ = request.sequence_;
+    response.orderId_ = request.orderId_;
+
+    try {
+        typename Book::Trades trades;
+        switch (static_cast<GatewayMessage>(request.message_)) {
+            case GatewayMessage::Add:
+                trades = book.AddOrder(MakeEntryOrder<Book>(DecodeEntry(request)));
+                break;
+            case GatewayMessage::Cancel:
+                book.CancelOrder(request.orderId_);
+                break;
+            case GatewayMessage::Modify:
+                if (request.side_ > static_cast<std::uint8_t>(Side::Sell))
+                    throw std::invalid_argument("Invalid side");
+                ValidateModify(request.price_, request.quantity_);
+                trades = book.Match(typename Book::OrderModify{request.orderId_, static_cast<Side>(request.side_),
+                    request.price_, request.quantity_});
+                break;
+            default:
+                throw std::invalid_argument("Invalid message");
+        }
+
+        response.status_ = static_cast<std::uint8_t>(GatewayStatus::Accepted);
+        response.trades_ = static_cast<std::uint32_t>(trades.size());
+        for (const auto& trade : trades) {
+            if (trade.getBidTrade().orderId_ == request.orderId_ || trade.geAskTrade().orderId_ == request.orderId_)
+                response.filledQuantity_ += static_cast<Quantity>(trade.getBidTrade().quantity_);
+        }
+    }
+    catch (const std::exception& e) {
+        response.status_ = static_cast<std::uint8_t>(GatewayStatus::Rejected);
+        std::strncpy(response.text_, e.what(), sizeof(response.text_) - 1);
+    }
+}
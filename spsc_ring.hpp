@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Bounded single producer, single consumer queue of fixed size records. It holds no pointers and its
+ * indexes are lock free atomics, so it can be placed in memory shared between processes and used from
+ * both sides. The producer only writes tail_, the consumer only writes head_, and the two live on
+ * separate cache lines so neither side's stores invalidate the line the other one polls.
+ */
+template <typename Record, std::size_t Capacity>
+class SpscRing
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Ring capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<Record>, "Ring records are copied as bytes");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared memory rings need lock free indexes");
+
+    private:
+        static constexpr std::size_t CacheLine = 64;
+
+        alignas(CacheLine) std::atomic<std::uint64_t> head_ {0}; // Next record to read
+        alignas(CacheLine) std::atomic<std::uint64_t> tail_ {0}; // Next record to write
+        alignas(CacheLine) std::array<Record, Capacity> records_;
+
+    public:
+        // Producer side. False when the ring is full
+        bool TryPush(const Record& record)
+        {
+            const auto tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_.load(std::memory_order_acquire) == Capacity)
+                return false;
+
+            records_[tail & (Capacity - 1)] = record;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. False when the ring is empty
+        bool TryPop(Record& record)
+        {
+            const auto head = head_.load(std::memory_order_relaxed);
+            if (head == tail_.load(std::memory_order_acquire))
+                return false;
+
+            record = records_[head & (Capacity - 1)];
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Whether a push would fail now. When the producer sees false, its next push succeeds
+        bool Full() const
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire) == Capacity;
+        }
+
+        bool Empty() const
+        {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+        }
+};
@@ -0,0 +1,407 @@
+#include "tcp_gateway.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    template <typename Integer>
+    void Store(std::uint8_t* out, Integer value)
+    {
+        const auto bits = static_cast<std::make_unsigned_t<Integer>>(value);
+        for (std::size_t i = 0; i < sizeof(Integer); ++i)
+            out[i] = static_cast<std::uint8_t>(bits >> (8 * i));
+    }
+
+    template <typename Integer>
+    Integer Load(const std::uint8_t* in)
+    {
+        std::make_unsigned_t<Integer> bits = 0;
+        for (std::size_t i = 0; i < sizeof(Integer); ++i)
+            bits |= static_cast<std::make_unsigned_t<Integer>>(in[i]) << (8 * i);
+        return static_cast<Integer>(bits);
+    }
+
+    void EncodeRequest(const GatewayRequest& request, std::uint8_t* out)
+    {
+        std::memset(out, 0, TcpGateway::RequestSize);
+        Store(out + 0, request.sequence_);
+        Store(out + 8, request.orderId_);
+        Store(out + 16, request.price_);
+        Store(out + 20, request.stopPrice_);
+        Store(out + 24, request.pegOffset_);
+        Store(out + 28, request.quantity_);
+        Store(out + 32, request.displayQuantity_);
+        Store(out + 36, request.owner_);
+        out[40] = request.message_;
+        out[41] = request.orderType_;
+        out[42] = request.side_;
+        out[43] = request.postOnly_;
+        out[44] = request.selfTradePrevention_;
+    }
+
+    GatewayRequest DecodeRequest(const std::uint8_t* in)
+    {
+        GatewayRequest request{};
+        request.sequence_ = Load<std::uint64_t>(in + 0);
+        request.orderId_ = Load<OrderId>(in + 8);
+        request.price_ = Load<Price>(in + 16);
+        request.stopPrice_ = Load<Price>(in + 20);
+        request.pegOffset_ = Load<Price>(in + 24);
+        request.quantity_ = Load<Quantity>(in + 28);
+        request.displayQuantity_ = Load<Quantity>(in + 32);
+        request.owner_ = Load<OwnerId>(in + 36);
+        request.message_ = in[40];
+        request.orderType_ = in[41];
+        request.side_ = in[42];
+        request.postOnly_ = in[43];
+        request.selfTradePrevention_ = in[44];
+        return request;
+    }
+
+    void EncodeResponse(std::uint64_t sessionSequence, const GatewayResponse& response, std::uint8_t* out)
+    {
+        std::memset(out, 0, TcpGateway::ResponseSize);
+        Store(out + 0, sessionSequence);
+        Store(out + 8, response.sequence_);
+        Store(out + 16, response.orderId_);
+        Store(out + 24, response.filledQuantity_);
+        Store(out + 28, response.trades_);
+        out[32] = response.status_;
+        std::memcpy(out + 33, response.text_, sizeof(response.text_));
+    }
+
+    SequencedResponse DecodeResponse(const std::uint8_t* in)
+    {
+        SequencedResponse sequenced{};
+        sequenced.sessionSequence_ = Load<std::uint64_t>(in + 0);
+        auto& response = sequenced.response_;
+        response.sequence_ = Load<std::uint64_t>(in + 8);
+        response.orderId_ = Load<OrderId>(in + 16);
+        response.filledQuantity_ = Load<Quantity>(in + 24);
+        response.trades_ = Load<std::uint32_t>(in + 28);
+        response.status_ = in[32];
+        std::memcpy(response.text_, in + 33, sizeof(response.text_) - 1);
+        return sequenced;
+    }
+
+    std::runtime_error SystemError(const std::string& what)
+    {
+        return std::runtime_error(what + ": " + std::strerror(errno));
+    }
+}
+
+#if defined(__linux__)
+
+TcpGateway::TcpGateway(std::uint16_t port, Handler handler)
+: handler_{std::move(handler)}
+{
+    listener_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    const int on = 1;
+    setsockopt(listener_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    socklen_t length = sizeof(address);
+    if (listener_ < 0 || bind(listener_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || listen(listener_, SOMAXCONN) != 0
+        || getsockname(listener_, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        const auto error = SystemError("Cannot listen on port " + std::to_string(port));
+        if (listener_ >= 0)
+            close(listener_);
+        throw error;
+    }
+    port_ = ntohs(address.sin_port);
+
+    epoll_ = epoll_create1(EPOLL_CLOEXEC);
+    wakeup_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = listener_;
+    epoll_ctl(epoll_, EPOLL_CTL_ADD, listener_, &event);
+    event.data.fd = wakeup_;
+    epoll_ctl(epoll_, EPOLL_CTL_ADD, wakeup_, &event);
+
+    thread_ = std::thread{ [this] { Loop(); } };
+}
+
+TcpGateway::~TcpGateway()
+{
+    const std::uint64_t one = 1;
+    [[maybe_unused]] const auto written = write(wakeup_, &one, sizeof(one));
+    thread_.join();
+
+    for (auto& [fd, session] : sessions_)
+        close(fd);
+    close(wakeup_);
+    close(epoll_);
+    close(listener_);
+}
+
+void TcpGateway::Loop()
+{
+    constexpr int MaxEvents = 64;
+    epoll_event events[MaxEvents];
+    std::vector<Session*> closed;
+
+    while (true) {
+        const int ready = epoll_wait(epoll_, events, MaxEvents, -1);
+        if (ready < 0 && errno == EINTR)
+            continue;
+
+        for (int i = 0; i < ready; ++i) {
+            const int fd = events[i].data.fd;
+            if (fd == wakeup_)
+                return;
+            if (fd == listener_) {
+                Accept();
+                continue;
+            }
+
+            auto& session = *sessions_.at(fd);
+            if (events[i].events & EPOLLOUT) {
+                session.writable_ = true;
+                Flush(session);
+            }
+            if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !Read(session))
+                closed.push_back(&session);
+        }
+
+        // Requests of sessions the peer closed in this round are still served
+        Serve();
+        for (auto* session : closed)
+            Close(*session);
+        closed.clear();
+    }
+}
+
+void TcpGateway::Accept()
+{
+    while (true) {
+        const int fd = accept4(listener_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+            return;
+
+        // Responses are small and latency bound, never hold them back for coalescing
+        const int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        event.data.fd = fd;
+        epoll_ctl(epoll_, EPOLL_CTL_ADD, fd, &event);
+        auto session = std::make_unique<Session>();
+        session->fd_ = fd;
+        sessions_.emplace(fd, std::move(session));
+        sessionCount_.store(sessions_.size(), std::memory_order_relaxed);
+    }
+}
+
+bool TcpGateway::Read(Session& session)
+{
+    // A session closing after a reject reads nothing more, the hang up that follows its shutdown ends it
+    if (session.closing_)
+        return !session.output_.empty();
+
+    std::uint8_t buffer[64 * RequestSize];
+    while (!session.closing_) {
+        const auto received = read(session.fd_, buffer, sizeof(buffer));
+        if (received == 0)
+            return false;
+        if (received < 0 && errno == EINTR)
+            continue;
+        if (received < 0)
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+
+        session.input_.insert(session.input_.end(), buffer, buffer + received);
+        std::size_t offset = 0;
+        for (; offset + RequestSize <= session.input_.size() && !session.closing_; offset += RequestSize) {
+            const auto request = DecodeRequest(session.input_.data() + offset);
+            if (request.sequence_ == session.expectedSequence_) {
+                ++session.expectedSequence_;
+                pending_.push_back(Pending{&session, request, false});
+                continue;
+            }
+
+            // Answered after the batch, so the session's responses stay in order
+            GatewayResponse reject{};
+            reject.sequence_ = request.sequence_;
+            reject.orderId_ = request.orderId_;
+            reject.status_ = static_cast<std::uint8_t>(GatewayStatus::Rejected);
+            std::snprintf(reject.text_, sizeof(reject.text_), "Expected sequence %llu",
+                static_cast<unsigned long long>(session.expectedSequence_));
+            pending_.push_back(Pending{&session, request, true});
+            rejects_.push_back(reject);
+            session.closing_ = true;
+        }
+        session.input_.erase(session.input_.begin(), session.input_.begin() + offset);
+    }
+    return true;
+}
+
+void TcpGateway::Serve()
+{
+    if (pending_.empty())
+        return;
+
+    requests_.clear();
+    for (const auto& pending : pending_) {
+        if (!pending.rejected_)
+            requests_.push_back(pending.request_);
+    }
+    responses_.resize(requests_.size());
+    if (!requests_.empty())
+        handler_(requests_.data(), responses_.data(), requests_.size());
+
+    std::size_t served = 0;
+    std::size_t rejected = 0;
+    for (const auto& pending : pending_) {
+        const auto& response = pending.rejected_ ? rejects_[rejected++] : responses_[served++];
+        Respond(*pending.session_, response);
+    }
+    for (const auto& pending : pending_)
+        Flush(*pending.session_);
+
+    pending_.clear();
+    rejects_.clear();
+}
+
+void TcpGateway::Respond(Session& session, const GatewayResponse& response)
+{
+    const auto size = session.output_.size();
+    session.output_.resize(size + ResponseSize);
+    EncodeResponse(++session.responseSequence_, response, session.output_.data() + size);
+}
+
+void TcpGateway::Flush(Session& session)
+{
+    std::size_t offset = 0;
+    while (session.writable_ && offset < session.output_.size()) {
+        const auto sent = send(session.fd_, session.output_.data() + offset, session.output_.size() - offset, MSG_NOSIGNAL);
+        if (sent < 0) {
+            // Edge triggered: EPOLLOUT reports when the socket takes more
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                session.writable_ = false;
+            else if (errno != EINTR)
+                break;
+            continue;
+        }
+        offset += static_cast<std::size_t>(sent);
+    }
+    session.output_.erase(session.output_.begin(), session.output_.begin() + offset);
+
+    if (session.closing_ && session.output_.empty())
+        shutdown(session.fd_, SHUT_RDWR);
+}
+
+void TcpGateway::Close(Session& session)
+{
+    const int fd = session.fd_;
+    epoll_ctl(epoll_, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    sessions_.erase(fd);
+    sessionCount_.store(sessions_.size(), std::memory_order_relaxed);
+}
+
+TcpGatewayClient::TcpGatewayClient(const std::string& host, std::uint16_t port)
+{
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses) != 0 || !addresses)
+        throw std::runtime_error("Cannot resolve " + host);
+
+    fd_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const bool connected = fd_ >= 0 && connect(fd_, addresses->ai_addr, addresses->ai_addrlen) == 0;
+    freeaddrinfo(addresses);
+    if (!connected) {
+        const auto error = SystemError("Cannot connect to " + host + ":" + std::to_string(port));
+        if (fd_ >= 0)
+            close(fd_);
+        throw error;
+    }
+
+    const int on = 1;
+    setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+}
+
+TcpGatewayClient::~TcpGatewayClient()
+{
+    close(fd_);
+}
+
+std::uint64_t TcpGatewayClient::Send(GatewayRequest request)
+{
+    request.sequence_ = ++sequence_;
+    SendRaw(request);
+    return request.sequence_;
+}
+
+void TcpGatewayClient::SendRaw(const GatewayRequest& request)
+{
+    std::uint8_t message[TcpGateway::RequestSize];
+    EncodeRequest(request, message);
+    std::size_t offset = 0;
+    while (offset < sizeof(message)) {
+        const auto sent = send(fd_, message + offset, sizeof(message) - offset, MSG_NOSIGNAL);
+        if (sent < 0 && errno != EINTR)
+            throw SystemError("Cannot send request");
+        if (sent > 0)
+            offset += static_cast<std::size_t>(sent);
+    }
+}
+
+bool TcpGatewayClient::Receive(SequencedResponse& response)
+{
+    std::uint8_t chunk[64 * TcpGateway::ResponseSize];
+    while (buffer_.size() < TcpGateway::ResponseSize) {
+        const auto received = read(fd_, chunk, sizeof(chunk));
+        if (received < 0 && errno == EINTR)
+            continue;
+        if (received <= 0)
+            return false;
+        buffer_.insert(buffer_.end(), chunk, chunk + received);
+    }
+
+    response = DecodeResponse(buffer_.data());
+    buffer_.erase(buffer_.begin(), buffer_.begin() + TcpGateway::ResponseSize);
+    return true;
+}
+
+#else
+
+TcpGateway::TcpGateway(std::uint16_t port, Handler handler)
+: handler_{std::move(handler)}
+{
+    throw std::runtime_error("The TCP gateway is only supported on Linux, cannot listen on port " + std::to_string(port));
+}
+
+TcpGateway::~TcpGateway() = default;
+
+TcpGatewayClient::TcpGatewayClient(const std::string& host, std::uint16_t port)
+{
+    throw std::runtime_error("The TCP gateway is only supported on Linux, cannot connect to " + host + ":" + std::to_string(port));
+}
+
+TcpGatewayClient::~TcpGatewayClient() = default;
+std::uint64_t TcpGatewayClient::Send(GatewayRequest) { return 0; }
+void TcpGatewayClient::SendRaw(const GatewayRequest&) {}
+bool TcpGatewayClient::Receive(SequencedResponse&) { return false; }
+
+#endif
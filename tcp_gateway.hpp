@@ -0,0 +1,118 @@
+#pragma once
+#include "shm_gateway.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Binary order entry over TCP, in the spirit of OUCH and BOE, for clients that do not want the protobuf and
+ * HTTP/2 stack. Every message has a fixed length and all integers are little-endian.
+ *
+ * Client to server, RequestSize bytes, the fields of a GatewayRequest in declaration order:
+ *   0 sequence u64, 8 order id u64, 16 price i32, 20 stop price i32, 24 peg offset i32, 28 quantity u32,
+ *   32 display quantity u32, 36 owner u32, 40 message u8, 41 order type u8, 42 side u8, 43 post only u8,
+ *   44 self trade prevention u8, 45 reserved
+ * Server to client, ResponseSize bytes:
+ *   0 session sequence u64, 8 request sequence u64, 16 order id u64, 24 filled quantity u32, 28 trades u32,
+ *   32 status u8, 33 reason (39 bytes, NUL padded)
+ *
+ * Sequence numbers are per session, a session being one connection. The client numbers its requests 1, 2, 3...
+ * and the server numbers its responses the same way. A request out of sequence is rejected and the server
+ * closes the session after the reject. Requests are handed to the handler in batches: everything that
+ * arrived from all sessions in one wakeup of the listener thread.
+ */
+class TcpGateway
+{
+    public:
+        static constexpr std::size_t RequestSize = 64;
+        static constexpr std::size_t ResponseSize = 72;
+
+        // Serve requests[0, count) into responses[0, count)
+        using Handler = std::function<void(const GatewayRequest* requests, GatewayResponse* responses, std::size_t count)>;
+
+        // Listen on port (0 picks a free one) of all interfaces and serve on a thread of its own.
+        // std::runtime_error if the port cannot be bound
+        TcpGateway(std::uint16_t port, Handler handler);
+        TcpGateway(const TcpGateway&) = delete;
+        TcpGateway& operator=(const TcpGateway&) = delete;
+        // Closes every session
+        ~TcpGateway();
+
+        std::uint16_t Port() const { return port_; }
+        std::size_t Sessions() const { return sessionCount_.load(std::memory_order_relaxed); }
+
+    private:
+        struct Session {
+            int fd_ {-1};
+            std::uint64_t expectedSequence_ {1};
+            std::uint64_t responseSequence_ {0};
+            std::vector<std::uint8_t> input_;   // Bytes of an incomplete request
+            std::vector<std::uint8_t> output_;  // Responses the socket did not take yet
+            bool writable_ {true};
+            bool closing_ {false};  // Close once output_ is flushed
+        };
+
+        struct Pending {
+            Session* session_;
+            GatewayRequest request_;
+            bool rejected_;  // Out of sequence, answered from rejects_ instead of by the handler
+        };
+
+        Handler handler_;
+        int listener_ {-1};
+        int epoll_ {-1};
+        int wakeup_ {-1};   // eventfd that stops the thread
+        std::uint16_t port_ {};
+        std::unordered_map<int, std::unique_ptr<Session>> sessions_;
+        std::atomic<std::size_t> sessionCount_ {0};
+        // Reused across wakeups
+        std::vector<Pending> pending_;
+        std::vector<GatewayResponse> rejects_;
+        std::vector<GatewayRequest> requests_;
+        std::vector<GatewayResponse> responses_;
+        std::thread thread_;
+
+        void Loop();
+        void Accept();
+        // Read what the socket has and queue complete requests. False if the peer went away
+        bool Read(Session& session);
+        void Respond(Session& session, const GatewayResponse& response);
+        void Flush(Session& session);
+        void Close(Session& session);
+        void Serve();
+};
+
+// A response with the sequence number the session gave it
+struct SequencedResponse {
+    std::uint64_t sessionSequence_;
+    GatewayResponse response_;
+};
+
+// Blocking client of one session
+class TcpGatewayClient
+{
+    public:
+        // Connect to host (an IPv4 address or name) and port. std::runtime_error on failure
+        TcpGatewayClient(const std::string& host, std::uint16_t port);
+        TcpGatewayClient(const TcpGatewayClient&) = delete;
+        TcpGatewayClient& operator=(const TcpGatewayClient&) = delete;
+        ~TcpGatewayClient();
+
+        // Number request with the next session sequence and send it. Returns the sequence
+        std::uint64_t Send(GatewayRequest request);
+        // Send as is, sequence included
+        void SendRaw(const GatewayRequest& request);
+        // Block for the next response. False once the server closed the session
+        bool Receive(SequencedResponse& response);
+
+    private:
+        int fd_ {-1};
+        std::uint64_t sequence_ {0};
+        std::vector<std::uint8_t> buffer_;
+};
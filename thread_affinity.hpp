@@ -0,0 +1,38 @@
+#pragma once
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Pinning threads to CPUs and waiting politely in busy-poll loops. Pinning is only implemented on Linux,
+// elsewhere it reports failure and the thread keeps floating
+
+// Restrict thread to cpu. False if the CPU does not exist, is not in the process mask, or pinning is unsupported
+inline bool PinThread(std::thread::native_handle_type thread, int cpu)
+{
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpu;
+    return false;
+#endif
+}
+
+// Hint to the CPU that this is a spin loop: it backs off the pipeline and leaves a sibling hyperthread room to run
+inline void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
@@ -0,0 +1,164 @@
+#include "trace.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+    struct RingSlot {
+        std::atomic<Tracer::Ring*> ring_ {nullptr};
+        std::atomic<bool> inUse_ {false};
+    };
+
+    // Rings are never freed. A thread that exits hands its ring back, its events stay readable until the
+    // ring is claimed by another thread, and the signal handler never sees a dangling pointer
+    std::array<RingSlot, Tracer::MaxRings> ringSlots;
+    std::atomic<std::uint32_t> nextThreadIndex {0};
+
+    std::atomic<double> ticksPerNanosecond {0.0};
+    char dumpPath[256];
+
+    // Gives the ring back to the registry when the owning thread exits
+    struct RingRelease {
+        RingSlot* slot_ {nullptr};
+        ~RingRelease()
+        {
+            if (slot_)
+                slot_->inUse_.store(false, std::memory_order_release);
+        }
+    };
+
+    bool WriteAll(int fd, const void* data, std::size_t size)
+    {
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            const auto written = ::write(fd, bytes, size);
+            if (written <= 0)
+                return false;
+            bytes += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+    void OnDumpSignal(int)
+    {
+        const int savedErrno = errno;
+        Tracer::Dump(dumpPath);
+        errno = savedErrno;
+    }
+}
+
+Tracer::Ring* Tracer::ClaimRing()
+{
+    thread_local RingRelease release;
+    claimed_ = true;
+
+    for (auto& slot : ringSlots) {
+        bool expected = false;
+        if (!slot.inUse_.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            continue;
+
+        Ring* ring = slot.ring_.load(std::memory_order_acquire);
+        if (!ring) {
+            ring = new Ring{};
+            slot.ring_.store(ring, std::memory_order_release);
+        }
+        else {
+            // Events of the previous owner are dropped rather than attributed to this thread
+            ring->head_.store(0, std::memory_order_release);
+        }
+        ring->threadIndex_ = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+        release.slot_ = &slot;
+        localRing_ = ring;
+        return ring;
+    }
+
+    return nullptr;
+}
+
+double Tracer::TicksPerNanosecond()
+{
+    auto cached = ticksPerNanosecond.load(std::memory_order_relaxed);
+    if (cached > 0.0)
+        return cached;
+
+    using namespace std::chrono;
+    const auto startTicks = ReadTimestamp();
+    const auto startTime = steady_clock::now();
+    std::this_thread::sleep_for(milliseconds(20));
+    const auto endTicks = ReadTimestamp();
+    const auto endTime = steady_clock::now();
+
+    const auto elapsed = duration_cast<nanoseconds>(endTime - startTime).count();
+    cached = elapsed > 0 ? static_cast<double>(endTicks - startTicks) / static_cast<double>(elapsed) : 1.0;
+    ticksPerNanosecond.store(cached, std::memory_order_relaxed);
+    return cached;
+}
+
+bool Tracer::Dump(const char* path)
+{
+    // No calibration here: sleeping is not allowed in a signal handler. InstallDumpOnSignal calibrates up front
+    const auto calibration = ticksPerNanosecond.load(std::memory_order_relaxed);
+
+    const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+
+    std::uint32_t ringCount = 0;
+    for (const auto& slot : ringSlots)
+        if (slot.ring_.load(std::memory_order_acquire))
+            ++ringCount;
+
+    TraceFileHeader header {};
+    header.magic_ = TraceFileMagic;
+    header.version_ = TraceFileVersion;
+    header.ringCount_ = ringCount;
+    header.ticksPerNanosecond_ = calibration > 0.0 ? calibration : 1.0;
+    bool ok = WriteAll(fd, &header, sizeof(header));
+
+    std::uint32_t written = 0;
+    for (const auto& slot : ringSlots) {
+        const Ring* ring = slot.ring_.load(std::memory_order_acquire);
+        if (!ok || !ring || written == ringCount)
+            continue;
+
+        const auto head = ring->head_.load(std::memory_order_acquire);
+        const auto count = std::min<std::uint64_t>(head, RingCapacity);
+
+        TraceRingHeader ringHeader {};
+        ringHeader.threadIndex_ = ring->threadIndex_;
+        ringHeader.count_ = static_cast<std::uint32_t>(count);
+        ringHeader.totalRecorded_ = head;
+        ok = WriteAll(fd, &ringHeader, sizeof(ringHeader));
+
+        // Oldest event first: the part after the head wraps around to the beginning of the array
+        const auto start = (head - count) & (RingCapacity - 1);
+        const auto firstChunk = std::min<std::uint64_t>(count, RingCapacity - start);
+        ok = ok && WriteAll(fd, ring->events_ + start, firstChunk * sizeof(TraceEvent));
+        ok = ok && WriteAll(fd, ring->events_, (count - firstChunk) * sizeof(TraceEvent));
+        ++written;
+    }
+
+    ::close(fd);
+    return ok;
+}
+
+bool Tracer::InstallDumpOnSignal(int signalNumber, const char* path)
+{
+    if (std::strlen(path) >= sizeof(dumpPath))
+        return false;
+
+    std::strcpy(dumpPath, path);
+    TicksPerNanosecond();
+
+    struct sigaction action {};
+    action.sa_handler = OnDumpSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    return ::sigaction(signalNumber, &action, nullptr) == 0;
+}
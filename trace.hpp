@@ -0,0 +1,135 @@
+#pragma once
+#include "types.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+/*
+ * Low-overhead binary event trace for the matching engine.
+ * Every thread that records an event owns a fixed-size ring of TraceEvents. Recording is a timestamp read
+ * plus a 40 byte store into the ring, no locks and no allocation after the ring is claimed.
+ * The rings can be dumped to a file (optionally from a signal handler) and turned into a readable
+ * timeline with order_book_trace_decode.
+ */
+
+// Kinds of events the engine records
+enum class TraceEventType : std::uint8_t {
+    OrderAdded,
+    OrderCancelled,
+    OrderMatched,
+    LevelCreated,
+    LevelErased,
+    PruneBegin,
+    PruneEnd,
+    OrderReplenished,
+    StopTriggered,
+    OrderAmended,
+};
+
+// Side as stored in a trace event. Level and prune events are not tied to a side
+enum class TraceSide : std::uint8_t {
+    Buy,
+    Sell,
+    None,
+};
+
+// A single fixed-size trace record. Price and quantity are stored widened so the format does not depend on types.hpp
+struct TraceEvent {
+    std::uint64_t timestamp_;  // Raw timestamp ticks, see Tracer::ReadTimestamp
+    std::uint64_t orderId_;    // Order involved, 0 when not applicable
+    std::int64_t price_;       // Price involved
+    std::uint64_t quantity_;   // Quantity involved (number of orders for prune events)
+    TraceEventType type_;
+    TraceSide side_;
+    std::uint8_t flags_;       // OrderMatched: 1 if the order was fully filled
+    std::uint8_t padding_[5];
+};
+
+static_assert(sizeof(TraceEvent) == 40, "TraceEvent is part of the dump format");
+
+// Layout of a dump file:
+//   TraceFileHeader, then ringCount_ times (TraceRingHeader followed by TraceRingHeader::count_ TraceEvents, oldest first)
+struct TraceFileHeader {
+    std::uint64_t magic_;          // TraceFileMagic
+    std::uint32_t version_;
+    std::uint32_t ringCount_;
+    double ticksPerNanosecond_;    // Calibration for TraceEvent::timestamp_
+};
+
+struct TraceRingHeader {
+    std::uint32_t threadIndex_;    // Order in which the thread first recorded an event
+    std::uint32_t count_;          // Number of events that follow
+    std::uint64_t totalRecorded_;  // Events recorded over the lifetime of the ring, including overwritten ones
+};
+
+constexpr std::uint64_t TraceFileMagic = 0x314543415254424FULL; // "OBTRACE1" read as little-endian
+constexpr std::uint32_t TraceFileVersion = 1;
+
+class Tracer {
+    public:
+        // Events kept per thread. Must be a power of two
+        static constexpr std::size_t RingCapacity = 1 << 14;
+        // Maximum number of threads that can own a ring at the same time
+        static constexpr std::size_t MaxRings = 64;
+
+        struct Ring {
+            std::atomic<std::uint64_t> head_ {0};
+            std::uint32_t threadIndex_ {0};
+            TraceEvent events_[RingCapacity];
+        };
+
+        static std::uint64_t ReadTimestamp()
+        {
+#if defined(__x86_64__) || defined(_M_X64)
+            return __rdtsc();
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+
+        static void Record(TraceEventType type, OrderId orderId, TraceSide side, std::int64_t price, std::uint64_t quantity, std::uint8_t flags = 0)
+        {
+#ifdef ORDERBOOK_ENABLE_TRACE
+            Ring* ring = LocalRing();
+            if (!ring)
+                return;
+
+            const auto head = ring->head_.load(std::memory_order_relaxed);
+            TraceEvent& event = ring->events_[head & (RingCapacity - 1)];
+            event.timestamp_ = ReadTimestamp();
+            event.orderId_ = orderId;
+            event.price_ = price;
+            event.quantity_ = quantity;
+            event.type_ = type;
+            event.side_ = side;
+            event.flags_ = flags;
+            // Publish after the event is written so a dump never reads a half written slot as valid
+            ring->head_.store(head + 1, std::memory_order_release);
+#else
+            (void)type; (void)orderId; (void)side; (void)price; (void)quantity; (void)flags;
+#endif
+        }
+
+        static TraceSide ToTraceSide(Side side) { return side == Side::Buy ? TraceSide::Buy : TraceSide::Sell; }
+
+        // Write every ring to path. Only uses async-signal-safe calls, so it can run inside a signal handler
+        static bool Dump(const char* path);
+        // Dump the rings to path whenever signalNumber is delivered (e.g. SIGUSR1)
+        static bool InstallDumpOnSignal(int signalNumber, const char* path);
+        // Ticks of ReadTimestamp per nanosecond, measured once
+        static double TicksPerNanosecond();
+
+    private:
+        inline static thread_local Ring* localRing_ = nullptr;
+        inline static thread_local bool claimed_ = false;
+
+        // localRing_ stays null when every ring was taken, the thread then records nothing
+        static Ring* LocalRing() { return claimed_ ? localRing_ : ClaimRing(); }
+        // Slow path on the first event of a thread: take a free ring from the registry
+        static Ring* ClaimRing();
+};
@@ -0,0 +1,124 @@
+#include "trace.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Offline decoder for dumps written by Tracer::Dump. Merges the per-thread rings into one timeline
+
+namespace {
+    struct DecodedEvent {
+        std::uint32_t threadIndex_;
+        TraceEvent event_;
+    };
+
+    const char* ToString(TraceEventType type)
+    {
+        switch (type) {
+            case TraceEventType::OrderAdded: return "OrderAdded";
+            case TraceEventType::OrderCancelled: return "OrderCancelled";
+            case TraceEventType::OrderMatched: return "OrderMatched";
+            case TraceEventType::LevelCreated: return "LevelCreated";
+            case TraceEventType::LevelErased: return "LevelErased";
+            case TraceEventType::PruneBegin: return "PruneBegin";
+            case TraceEventType::PruneEnd: return "PruneEnd";
+            case TraceEventType::OrderReplenished: return "OrderReplenished";
+            case TraceEventType::StopTriggered: return "StopTriggered";
+            case TraceEventType::OrderAmended: return "OrderAmended";
+        }
+        return "Unknown";
+    }
+
+    const char* ToString(TraceSide side)
+    {
+        switch (side) {
+            case TraceSide::Buy: return "Buy";
+            case TraceSide::Sell: return "Sell";
+            case TraceSide::None: return "-";
+        }
+        return "?";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        std::cerr << "usage: " << argv[0] << " <trace dump>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    TraceFileHeader header {};
+    if (!input.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic_ != TraceFileMagic) {
+        std::cerr << argv[1] << " is not an order book trace dump" << std::endl;
+        return 1;
+    }
+    if (header.version_ != TraceFileVersion) {
+        std::cerr << "unsupported trace version " << header.version_ << std::endl;
+        return 1;
+    }
+
+    std::vector<DecodedEvent> events;
+    for (std::uint32_t ring = 0; ring < header.ringCount_; ++ring) {
+        TraceRingHeader ringHeader {};
+        if (!input.read(reinterpret_cast<char*>(&ringHeader), sizeof(ringHeader)))
+            break;
+
+        if (ringHeader.totalRecorded_ > ringHeader.count_)
+            std::cout << "# thread " << ringHeader.threadIndex_ << ": " << ringHeader.totalRecorded_ - ringHeader.count_
+                      << " older events were overwritten" << std::endl;
+
+        for (std::uint32_t i = 0; i < ringHeader.count_; ++i) {
+            DecodedEvent decoded { ringHeader.threadIndex_, {} };
+            if (!input.read(reinterpret_cast<char*>(&decoded.event_), sizeof(TraceEvent)))
+                break;
+            events.push_back(decoded);
+        }
+    }
+
+    if (events.empty()) {
+        std::cout << "# no events" << std::endl;
+        return 0;
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const DecodedEvent& lhs, const DecodedEvent& rhs) {
+        return lhs.event_.timestamp_ < rhs.event_.timestamp_;
+    });
+
+    const auto origin = events.front().event_.timestamp_;
+    for (const auto& [threadIndex, event] : events) {
+        const double micros = static_cast<double>(event.timestamp_ - origin) / header.ticksPerNanosecond_ / 1000.0;
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "%14.3fus  T%-3u %-16s %-4s",
+            micros, threadIndex, ToString(event.type_), ToString(event.side_));
+        std::cout << line;
+
+        switch (event.type_) {
+            case TraceEventType::OrderAdded:
+            case TraceEventType::OrderCancelled:
+            case TraceEventType::OrderReplenished:
+            case TraceEventType::OrderAmended:
+                std::cout << " id=" << event.orderId_ << " price=" << event.price_ << " qty=" << event.quantity_;
+                break;
+            case TraceEventType::StopTriggered:
+                std::cout << " id=" << event.orderId_ << " stop=" << event.price_ << " qty=" << event.quantity_;
+                break;
+            case TraceEventType::OrderMatched:
+                std::cout << " price=" << event.price_ << " qty=" << event.quantity_ << (event.flags_ ? " filled" : " partial");
+                break;
+            case TraceEventType::LevelCreated:
+            case TraceEventType::LevelErased:
+                std::cout << " price=" << event.price_;
+                break;
+            case TraceEventType::PruneBegin:
+            case TraceEventType::PruneEnd:
+                std::cout << " orders=" << event.quantity_;
+                break;
+        }
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -3,19 +3,23 @@
 #include <vector>
 
 // Represents information about a single side of a trade
-struct TradeInfo
+template <typename PriceType, typename QuantityType>
+struct BasicTradeInfo
 {
     OrderId orderId_;    // ID of the order involved in the trade
-    Price price_;       // Price at which the trade occurred
-    Quantity quantity_; // Quantity traded
+    PriceType price_;       // Price at which the trade occurred
+    QuantityType quantity_; // Quantity traded
 };
 
 // Represents a complete trade between a buy and sell order
 // A Trade object is an aggregation of two TradeInfo objects: one for bid one for ask
-class Trade 
+template <typename PriceType, typename QuantityType>
+class BasicTrade 
 {
     public:
-        Trade(const TradeInfo& bidTrade, const TradeInfo& askTrade)
+        using TradeInfo = BasicTradeInfo<PriceType, QuantityType>;
+
+        BasicTrade(const TradeInfo& bidTrade, const TradeInfo& askTrade)
         : bidTrade_ { bidTrade }, askTrade_ { askTrade }
         {}
 
@@ -27,5 +31,8 @@ class Trade
         TradeInfo askTrade_; // Information about the sell side of the trade
 };
 
+using TradeInfo = BasicTradeInfo<Price, Quantity>;
+using Trade = BasicTrade<Price, Quantity>;
+
 // Collection of trades
 using Trades = std::vector<Trade>; 
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "trade_tape.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+TradeTape::TradeTape(std::size_t capacity)
+: mask_{capacity - 1}
+{
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+        throw std::invalid_argument("Trade tape capacity " + std::to_string(capacity) + " is not a power of two");
+    slots_ = std::make_unique<Slot[]>(capacity);
+}
+
+std::uint64_t TradeTape::Record(std::uint64_t timestamp, Side aggressor, std::int64_t price, std::uint64_t quantity)
+{
+    const auto sequence = last_.load(std::memory_order_relaxed) + 1;
+
+    auto& slot = slots_[sequence & mask_];
+    slot.sequence_.store(0, std::memory_order_relaxed);
+    // Readers that see any of the new fields also see the cleared sequence
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp_.store(timestamp, std::memory_order_relaxed);
+    slot.price_.store(price, std::memory_order_relaxed);
+    slot.quantity_.store(quantity, std::memory_order_relaxed);
+    slot.aggressor_.store(aggressor, std::memory_order_relaxed);
+    slot.sequence_.store(sequence, std::memory_order_release);
+
+    last_.store(sequence, std::memory_order_release);
+    return sequence;
+}
+
+bool TradeTape::ReadSlot(std::uint64_t sequence, TradeRecord& record) const
+{
+    const auto& slot = slots_[sequence & mask_];
+    if (slot.sequence_.load(std::memory_order_acquire) != sequence)
+        return false;
+
+    record.sequence_ = sequence;
+    record.timestamp_ = slot.timestamp_.load(std::memory_order_relaxed);
+    record.price_ = slot.price_.load(std::memory_order_relaxed);
+    record.quantity_ = slot.quantity_.load(std::memory_order_relaxed);
+    record.aggressor_ = slot.aggressor_.load(std::memory_order_relaxed);
+
+    // The copy only counts if the writer did not start on the slot meanwhile
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence_.load(std::memory_order_relaxed) == sequence;
+}
+
+std::size_t TradeTape::Read(std::uint64_t since, std::size_t limit, TradeRecord* out) const
+{
+    const auto last = LastSequence();
+    std::size_t count = 0;
+    auto sequence = std::max(since + 1, Oldest(last));
+    while (count < limit && sequence <= last) {
+        if (ReadSlot(sequence, out[count])) {
+            ++count;
+            ++sequence;
+        }
+        else {
+            // Overwritten while we read, carry on with what the writer left
+            sequence = std::max(sequence + 1, Oldest(LastSequence()));
+        }
+    }
+    return count;
+}
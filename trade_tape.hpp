@@ -0,0 +1,62 @@
+#pragma once
+#include "types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/*
+ * Time and sales: the last trades of a book in a fixed ring of compact records. The book writes a record per
+ * trade on the thread that owns it (OrderBook::SetTradeTape) and any thread can read without a lock. Every slot carries
+ * the sequence of the trade in it, which the writer clears while it rewrites the slot, so a reader copies a
+ * record and keeps it only if the slot still holds the same sequence afterwards (a seqlock per slot).
+ * Readers never hold up the writer, a reader the writer laps loses the overwritten trades and sees the gap.
+ */
+
+// One trade. Price and quantity are stored widened so every book width fits
+struct TradeRecord {
+    std::uint64_t sequence_;   // Trade id, from 1 without gaps
+    std::uint64_t timestamp_;  // Nanoseconds since the epoch
+    std::int64_t price_;       // Price of the resting order
+    std::uint64_t quantity_;
+    Side aggressor_;           // Side of the order that took liquidity
+};
+
+class TradeTape
+{
+    public:
+        static constexpr std::size_t DefaultCapacity = 1 << 16;
+
+        // Keeps the last capacity trades. std::invalid_argument unless capacity is a power of two
+        explicit TradeTape(std::size_t capacity = DefaultCapacity);
+        TradeTape(const TradeTape&) = delete;
+        TradeTape& operator=(const TradeTape&) = delete;
+
+        // Writer side, one thread at a time. timestamp in nanoseconds since the epoch. Returns the trade's sequence
+        std::uint64_t Record(std::uint64_t timestamp, Side aggressor, std::int64_t price, std::uint64_t quantity);
+
+        // Copy up to limit trades after sequence since into out, oldest first, and return how many. Trades that
+        // were overwritten are skipped, a first sequence above since + 1 means the reader fell behind
+        std::size_t Read(std::uint64_t since, std::size_t limit, TradeRecord* out) const;
+        // Sequence of the latest trade, 0 before the first
+        std::uint64_t LastSequence() const { return last_.load(std::memory_order_acquire); }
+        std::size_t Capacity() const { return mask_ + 1; }
+
+    private:
+        // A record as atomics, so reading a slot while it is rewritten is a detected race and not a data race
+        struct Slot {
+            std::atomic<std::uint64_t> sequence_ {0}; // 0 while the slot is written
+            std::atomic<std::uint64_t> timestamp_ {0};
+            std::atomic<std::int64_t> price_ {0};
+            std::atomic<std::uint64_t> quantity_ {0};
+            std::atomic<Side> aggressor_ {Side::Buy};
+        };
+
+        std::size_t mask_;
+        std::unique_ptr<Slot[]> slots_;
+        std::atomic<std::uint64_t> last_ {0};
+
+        // Oldest trade still in the ring when last is the latest
+        std::uint64_t Oldest(std::uint64_t last) const { return last > mask_ ? last - mask_ : 1; }
+        bool ReadSlot(std::uint64_t sequence, TradeRecord& record) const;
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 
 // Order types supported by the order book
 enum class OrderType {
@@ -9,8 +11,37 @@ enum class OrderType {
     FillOrKill, // If not filled, cancel it
     GoodForDay, // If not filled by end of day, cancel it
     Market, // Give me whatever price I can, I just want to be filled
+    Iceberg, // Good till cancel that only shows a display quantity, the rest is a hidden reserve
+    Stop, // Held outside the book until the last trade price reaches the stop price, then becomes a market order
+    StopLimit, // Like Stop, but becomes a good till cancel order at its limit price
+    PrimaryPeg, // Priced at the best price of its own side plus an offset, follows it as the book moves
+    MidpointPeg, // Priced at the midpoint of the best bid and ask plus an offset
 };
 
+// What a post only order does if it would take liquidity on entry
+enum class PostOnly {
+    Off,
+    Reject, // Dropped without touching the book
+    Slide, // Repriced one tick behind the best opposite price so it rests
+};
+
+// What happens when two orders of the same owner would trade. The newest order's mode applies
+enum class SelfTradePrevention {
+    CancelNewest,
+    CancelOldest,
+    CancelBoth,
+    Decrement, // Both lose the smaller remaining quantity without a trade, which cancels the smaller order
+};
+
+// Trading phase of the book
+enum class TradingSession {
+    Continuous, // Orders match as they arrive
+    Auction, // Orders accumulate, possibly crossed, until the book is uncrossed at one price
+};
+
+// Number of OrderType values, keep in sync with the last enumerator
+constexpr std::size_t OrderTypeCount = static_cast<std::size_t>(OrderType::MidpointPeg) + 1;
+
 // Side of the order (Buy/Sell)
 // Other sides exist, such as no side, but we don't need it for now
 enum class Side {
@@ -19,25 +50,38 @@ enum class Side {
 };
 
 // Type aliases for better readability and maintainability
+// Default widths of prices and quantities. The order book can be built with others, see order_book_traits.hpp
 using Price = std::int32_t;
 using Quantity = std::uint32_t;
 using OrderId = std::uint64_t;
 using OrderIds = std::vector<OrderId>;
+// Participant that owns an order, used for self trade prevention
+using OwnerId = std::uint32_t;
 
-// Represents a price level in the order book with its total quantity
-struct LevelInfo 
+// Offset of a pegged order from its reference price. Never more aggressive than the reference:
+// zero or negative for buys, zero or positive for sells
+template <typename PriceType>
+struct BasicPegOffset
 {
-    Price price_;
-    Quantity quantity_;
+    PriceType offset_;
 };
 
-using LevelInfos = std::vector<LevelInfo>;
+// Represents a price level in the order book with its total quantity
+template <typename PriceType, typename QuantityType>
+struct BasicLevelInfo 
+{
+    PriceType price_;
+    QuantityType quantity_;
+};
 
 // Container for bid and ask level information
-class OrderBookLevelInfos
+template <typename PriceType, typename QuantityType>
+class BasicOrderBookLevelInfos
 {
     public:
-        OrderBookLevelInfos(const LevelInfos& bids, const LevelInfos& asks)
+        using LevelInfos = std::vector<BasicLevelInfo<PriceType, QuantityType>>;
+
+        BasicOrderBookLevelInfos(const LevelInfos& bids, const LevelInfos& asks)
         : bids_{bids}, asks_{asks}
         { }
 
@@ -47,4 +91,55 @@ class OrderBookLevelInfos
     private:
         LevelInfos bids_;
         LevelInfos asks_;
-}; 
\ No newline at end of file
+};
+
+// Which orders a mass cancel removes. Unset fields match everything, so an empty filter cancels the whole book
+template <typename PriceType>
+struct BasicMassCancelFilter
+{
+    std::optional<OwnerId> owner_;
+    std::optional<Side> side_;
+    // Inclusive price band: the limit price, the current price of pegged orders and the stop price of pending stops
+    std::optional<PriceType> minPrice_;
+    std::optional<PriceType> maxPrice_;
+};
+
+// Price that executes the most volume in an auction, and that volume
+template <typename PriceType>
+struct BasicAuctionEquilibrium
+{
+    PriceType price_;
+    std::uint64_t volume_;
+    std::uint64_t imbalance_; // Quantity left on the heavier side at price_
+};
+
+// Outcome of a mass cancel: the new quantity of every level it touched, 0 when the level is gone
+template <typename PriceType, typename QuantityType>
+struct BasicMassCancelResult
+{
+    std::size_t cancelled_ {};
+    std::vector<BasicLevelInfo<PriceType, QuantityType>> bids_;
+    std::vector<BasicLevelInfo<PriceType, QuantityType>> asks_;
+};
+
+// One resting order of an L3 snapshot
+template <typename PriceType, typename QuantityType>
+struct BasicOrderSnapshot
+{
+    OrderId orderId_;
+    PriceType price_;
+    QuantityType quantity_;     // Visible quantity, the reserve of an iceberg is not shown
+    std::uint32_t position_;    // Place in its price level, 0 trades first
+    Side side_;
+};
+
+// The types above at the default Price and Quantity widths. A book with other widths has its own aliases,
+// see BasicOrderBook
+using PegOffset = BasicPegOffset<Price>;
+using LevelInfo = BasicLevelInfo<Price, Quantity>;
+using LevelInfos = std::vector<LevelInfo>;
+using OrderBookLevelInfos = BasicOrderBookLevelInfos<Price, Quantity>;
+using MassCancelFilter = BasicMassCancelFilter<Price>;
+using AuctionEquilibrium = BasicAuctionEquilibrium<Price>;
+using MassCancelResult = BasicMassCancelResult<Price, Quantity>;
+using OrderSnapshot = BasicOrderSnapshot<Price, Quantity>;